@@ -0,0 +1,314 @@
+//----------------------------------------------------------------------------------------------------
+// AllocationTracker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AllocationTracker.hpp"
+
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#if !defined(GAME_DISABLE_ALLOCATION_TRACKING)
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Only the first few over-budget frames are logged each time the budget is armed; the count keeps going
+    int constexpr BUDGET_LOG_LIMIT = 8;
+
+    //------------------------------------------------------------------------------------------------
+    struct sAllocationTagCounters
+    {
+        std::atomic<uint64_t> m_allocationCount{0};
+        std::atomic<uint64_t> m_allocatedBytes{0};
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Plain statics with constant initialisation, so they are usable by allocations made before main()
+    sAllocationTagCounters s_tagCounters[ALLOCATION_MAX_TAGS];
+    std::atomic<uint64_t>  s_freeCount{0};
+    thread_local int       t_currentTagIndex = 0;
+
+    std::mutex       s_tagMutex;
+    char const*      s_tagNames[ALLOCATION_MAX_TAGS] = {"Untagged"};
+    std::atomic<int> s_tagCount{1};
+
+    // Main thread only
+    sAllocationFrameStats s_lastFrame;
+    int                   s_frameBudget          = -1;
+    bool                  s_isBudgetArmed        = false;
+    int                   s_overBudgetFrameCount = 0;
+    int                   s_budgetLogCount       = 0;
+
+    //------------------------------------------------------------------------------------------------
+    void RecordAllocation(size_t const size)
+    {
+        sAllocationTagCounters& counters = s_tagCounters[t_currentTagIndex];
+        counters.m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        counters.m_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void* AllocateTracked(size_t const size)
+    {
+        RecordAllocation(size);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void* AllocateTrackedAligned(size_t const size, std::align_val_t const alignment)
+    {
+        RecordAllocation(size);
+#if defined(_MSC_VER)
+        return _aligned_malloc(size == 0 ? 1 : size, static_cast<size_t>(alignment));
+#else
+        size_t const alignmentBytes = static_cast<size_t>(alignment);
+        return std::aligned_alloc(alignmentBytes, (size + alignmentBytes - 1) / alignmentBytes * alignmentBytes);
+#endif
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void FreeTracked(void* pointer)
+    {
+        if (pointer != nullptr)
+        {
+            s_freeCount.fetch_add(1, std::memory_order_relaxed);
+            std::free(pointer);
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void FreeTrackedAligned(void* pointer)
+    {
+        if (pointer != nullptr)
+        {
+            s_freeCount.fetch_add(1, std::memory_order_relaxed);
+#if defined(_MSC_VER)
+            _aligned_free(pointer);
+#else
+            std::free(pointer);
+#endif
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    String FormatTopTags(sAllocationFrameStats const& stats)
+    {
+        String text;
+        for (int i = 0; i < stats.m_tagCount; ++i)
+        {
+            if (stats.m_tags[i].m_allocationCount > 0)
+            {
+                text += StringFormat(" {}={}", stats.m_tags[i].m_name, stats.m_tags[i].m_allocationCount);
+            }
+        }
+        return text;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int AllocationTrackerRegisterTag(char const* name)
+{
+    std::lock_guard<std::mutex> const lock(s_tagMutex);
+
+    int const tagCount = s_tagCount.load(std::memory_order_relaxed);
+    for (int i = 0; i < tagCount; ++i)
+    {
+        if (std::strcmp(s_tagNames[i], name) == 0)
+        {
+            return i;
+        }
+    }
+
+    if (tagCount == ALLOCATION_MAX_TAGS)
+    {
+        return ALLOCATION_MAX_TAGS - 1;
+    }
+
+    s_tagNames[tagCount] = name;
+    s_tagCount.store(tagCount + 1, std::memory_order_release);
+
+    return tagCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AllocationTrackerEndFrame()
+{
+    sAllocationFrameStats& stats = s_lastFrame;
+
+    stats.m_allocationCount = 0;
+    stats.m_allocatedBytes  = 0;
+    stats.m_freeCount       = s_freeCount.exchange(0, std::memory_order_relaxed);
+    stats.m_tagCount        = s_tagCount.load(std::memory_order_acquire);
+
+    for (int i = 0; i < stats.m_tagCount; ++i)
+    {
+        sAllocationTagStats& tag = stats.m_tags[i];
+        tag.m_name               = s_tagNames[i];
+        tag.m_allocationCount    = s_tagCounters[i].m_allocationCount.exchange(0, std::memory_order_relaxed);
+        tag.m_allocatedBytes     = s_tagCounters[i].m_allocatedBytes.exchange(0, std::memory_order_relaxed);
+
+        stats.m_allocationCount += tag.m_allocationCount;
+        stats.m_allocatedBytes += tag.m_allocatedBytes;
+    }
+
+    if (s_frameBudget < 0 || !s_isBudgetArmed || stats.m_allocationCount <= static_cast<uint64_t>(s_frameBudget))
+    {
+        return;
+    }
+
+    ++s_overBudgetFrameCount;
+
+    if (s_budgetLogCount < BUDGET_LOG_LIMIT)
+    {
+        ++s_budgetLogCount;
+        DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(AllocationTrackerEndFrame)(over budget: {} allocations, {} bytes, budget {})(tags:{})", stats.m_allocationCount, stats.m_allocatedBytes, s_frameBudget, FormatTopTags(stats)));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sAllocationFrameStats const& AllocationTrackerGetLastFrame()
+{
+    return s_lastFrame;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AllocationTrackerSetFrameBudget(int const maxAllocationsPerFrame)
+{
+    s_frameBudget = maxAllocationsPerFrame;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AllocationTrackerGetFrameBudget()
+{
+    return s_frameBudget;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AllocationTrackerSetBudgetArmed(bool const isArmed)
+{
+    if (isArmed && !s_isBudgetArmed)
+    {
+        s_budgetLogCount = 0;
+    }
+
+    s_isBudgetArmed = isArmed;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AllocationTrackerIsBudgetArmed()
+{
+    return s_isBudgetArmed;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AllocationTrackerGetOverBudgetFrameCount()
+{
+    return s_overBudgetFrameCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+AllocationTagScope::AllocationTagScope(int const tagIndex)
+    : m_previousTagIndex(t_currentTagIndex)
+{
+    t_currentTagIndex = tagIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+AllocationTagScope::~AllocationTagScope()
+{
+    t_currentTagIndex = m_previousTagIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Global replacements. Every form forwards to the four helpers above, so the counts cannot miss a variant.
+void* operator new(size_t const size)
+{
+    if (void* const pointer = AllocateTracked(size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t const size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t const size, std::nothrow_t const&) noexcept
+{
+    return AllocateTracked(size);
+}
+
+void* operator new[](size_t const size, std::nothrow_t const&) noexcept
+{
+    return AllocateTracked(size);
+}
+
+void* operator new(size_t const size, std::align_val_t const alignment)
+{
+    if (void* const pointer = AllocateTrackedAligned(size, alignment))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t const size, std::align_val_t const alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(size_t const size, std::align_val_t const alignment, std::nothrow_t const&) noexcept
+{
+    return AllocateTrackedAligned(size, alignment);
+}
+
+void* operator new[](size_t const size, std::align_val_t const alignment, std::nothrow_t const&) noexcept
+{
+    return AllocateTrackedAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept { FreeTracked(pointer); }
+void operator delete[](void* pointer) noexcept { FreeTracked(pointer); }
+void operator delete(void* pointer, size_t) noexcept { FreeTracked(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { FreeTracked(pointer); }
+void operator delete(void* pointer, std::nothrow_t const&) noexcept { FreeTracked(pointer); }
+void operator delete[](void* pointer, std::nothrow_t const&) noexcept { FreeTracked(pointer); }
+
+void operator delete(void* pointer, std::align_val_t) noexcept { FreeTrackedAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { FreeTrackedAligned(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { FreeTrackedAligned(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { FreeTrackedAligned(pointer); }
+void operator delete(void* pointer, std::align_val_t, std::nothrow_t const&) noexcept { FreeTrackedAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t, std::nothrow_t const&) noexcept { FreeTrackedAligned(pointer); }
+
+#else
+
+//----------------------------------------------------------------------------------------------------
+int                          AllocationTrackerRegisterTag(char const*) { return 0; }
+void                         AllocationTrackerEndFrame() {}
+void                         AllocationTrackerSetFrameBudget(int) {}
+int                          AllocationTrackerGetFrameBudget() { return -1; }
+void                         AllocationTrackerSetBudgetArmed(bool) {}
+bool                         AllocationTrackerIsBudgetArmed() { return false; }
+int                          AllocationTrackerGetOverBudgetFrameCount() { return 0; }
+AllocationTagScope::AllocationTagScope(int) : m_previousTagIndex(0) {}
+AllocationTagScope::~AllocationTagScope() {}
+
+//----------------------------------------------------------------------------------------------------
+sAllocationFrameStats const& AllocationTrackerGetLastFrame()
+{
+    static sAllocationFrameStats const s_emptyFrame;
+    return s_emptyFrame;
+}
+
+#endif
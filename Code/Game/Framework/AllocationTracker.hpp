@@ -0,0 +1,87 @@
+//----------------------------------------------------------------------------------------------------
+// AllocationTracker.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <array>
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// Per-frame heap allocation counts.
+//
+// AllocationTracker.cpp replaces the global operator new / delete, so every C++ allocation in the process is
+// counted: a couple of relaxed atomic adds on top of malloc. Allocations are attributed to the innermost
+// ALLOCATION_TAG("Name") scope on the allocating thread ("Untagged" outside any). AllocationTrackerEndFrame(),
+// called once per frame on the main thread, moves the counters into the last-frame stats.
+//
+// Only the C++ heap is seen: V8 allocates JS objects on its own heap, so script garbage shows up here only
+// where it crosses into C++ (argument vectors, strings returned to script and so on).
+//
+// A frame budget turns the counts into a check. While armed, a frame with more allocations than the budget
+// is counted and logged; BenchmarkRunner.js arms it for measured frames only, since loading and spawning
+// allocate by design. -allocationBudget=N sets it from the command line and makes the app exit non-zero if any
+// armed frame went over (see App::GetExitCode), so a benchmark run fails on a regression.
+//
+// Defining GAME_DISABLE_ALLOCATION_TRACKING leaves the global operators alone and compiles the tags out.
+//
+#if defined(GAME_DISABLE_ALLOCATION_TRACKING)
+#define ALLOCATION_TAG(name)
+#else
+#define ALLOCATION_TAG_CONCAT_INNER(a, b) a##b
+#define ALLOCATION_TAG_CONCAT(a, b)       ALLOCATION_TAG_CONCAT_INNER(a, b)
+#define ALLOCATION_TAG(name)                                                                                 \
+    static int const ALLOCATION_TAG_CONCAT(allocationTagIndex_, __LINE__) = AllocationTrackerRegisterTag(name); \
+    AllocationTagScope const ALLOCATION_TAG_CONCAT(allocationTagScope_, __LINE__)(ALLOCATION_TAG_CONCAT(allocationTagIndex_, __LINE__))
+#endif
+
+//----------------------------------------------------------------------------------------------------
+int constexpr ALLOCATION_MAX_TAGS = 32;     // Later tags share the last slot
+
+//----------------------------------------------------------------------------------------------------
+struct sAllocationTagStats
+{
+    char const* m_name            = nullptr;
+    uint64_t    m_allocationCount = 0;
+    uint64_t    m_allocatedBytes  = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Fixed size, so reading and refreshing the stats never allocates itself
+struct sAllocationFrameStats
+{
+    uint64_t                                            m_allocationCount = 0;
+    uint64_t                                            m_allocatedBytes  = 0;
+    uint64_t                                            m_freeCount       = 0;
+    int                                                 m_tagCount        = 0;
+    std::array<sAllocationTagStats, ALLOCATION_MAX_TAGS> m_tags;     // Registration order; entries with no allocations included
+};
+
+//----------------------------------------------------------------------------------------------------
+// Returns the tag's index; the name must outlive the tracker (a string literal). Same name, same index.
+int  AllocationTrackerRegisterTag(char const* name);
+void AllocationTrackerEndFrame();
+
+sAllocationFrameStats const& AllocationTrackerGetLastFrame();
+
+// maxAllocationsPerFrame < 0 turns the budget off
+void AllocationTrackerSetFrameBudget(int maxAllocationsPerFrame);
+int  AllocationTrackerGetFrameBudget();
+void AllocationTrackerSetBudgetArmed(bool isArmed);
+bool AllocationTrackerIsBudgetArmed();
+int  AllocationTrackerGetOverBudgetFrameCount();
+
+//----------------------------------------------------------------------------------------------------
+class AllocationTagScope
+{
+public:
+    explicit AllocationTagScope(int tagIndex);
+    ~AllocationTagScope();
+
+    AllocationTagScope(AllocationTagScope const&)            = delete;
+    AllocationTagScope& operator=(AllocationTagScope const&) = delete;
+
+private:
+    int m_previousTagIndex;
+};
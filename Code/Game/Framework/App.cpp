@@ -14,6 +14,7 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/JobSystem.hpp"
 #include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/Time.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Platform/Window.hpp"
@@ -23,8 +24,18 @@
 #include "Engine/Resource/ResourceSubsystem.hpp"
 #include "Engine/Script/ScriptSubsystem.hpp"
 #include "Game/Gameplay/Game.hpp"
+#include "Game/Framework/AllocationTracker.hpp"
+#include "Game/Framework/DeferredLog.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/ParallelFor.hpp"
+#include "Game/Framework/Profiler.hpp"
+#include "Game/Framework/StartupSequence.hpp"
 #include "ThirdParty/json/json.hpp"
+#include "ThirdParty/TinyXML2/tinyxml2.h"
+
+#include <algorithm>
+#include <fstream>
+#include <thread>
 
 //----------------------------------------------------------------------------------------------------
 App*                   g_app               = nullptr;       // Created and owned by Main_Windows.cpp
@@ -40,28 +51,173 @@ ScriptSubsystem*       g_scriptSubsystem   = nullptr;       // Created and owned
 //----------------------------------------------------------------------------------------------------
 STATIC bool App::m_isQuitting = false;
 
+//----------------------------------------------------------------------------------------------------
+// Before Startup(), so the options can shape how the subsystems are configured
+void App::ParseCommandLine(String const& commandLine)
+{
+    m_benchmarkOptions = ParseBenchmarkOptions(commandLine);
+    m_replayOptions    = ParseReplayOptions(commandLine);
+
+    if (m_benchmarkOptions.m_isEnabled)
+    {
+        DebuggerPrintf("Benchmark mode (DevTools %s), report: %s\n", m_benchmarkOptions.m_isDevToolsEnabled ? "on" : "off", m_benchmarkOptions.m_reportPath.c_str());
+    }
+
+    if (m_replayOptions.m_mode != eReplayMode::OFF)
+    {
+        DebuggerPrintf("Replay session: %s %s\n", GetReplayModeName(m_replayOptions.m_mode), m_replayOptions.m_path.c_str());
+    }
+
+    AllocationTrackerSetFrameBudget(m_benchmarkOptions.m_allocationBudget);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Runs as a startup task on an I/O worker, overlapping the DevConsole and Window setup
+static sLogSubsystemConfig LoadLogSubsystemConfig()
+{
+    sLogSubsystemConfig config;
+
+    try
+    {
+        std::ifstream configFile("Data/Config/LogConfig.json");
+        if (configFile.is_open())
+        {
+            nlohmann::json jsonConfig;
+            configFile >> jsonConfig;
+            config = sLogSubsystemConfig::FromJSON(jsonConfig);
+
+            // Simple success message (we can't use LogSubsystem yet as it's not initialized)
+            DebuggerPrintf("Loaded LogSubsystem config from JSON\n");
+        }
+        else
+        {
+            // Fallback to hardcoded defaults if JSON file not found
+            DebuggerPrintf("LogConfig.json not found, using default configuration\n");
+
+            config.logFilePath      = "Logs/ProtogameJS3D.log";
+            config.enableConsole    = true;
+            config.enableFile       = true;
+            config.enableDebugOut   = true;
+            config.enableOnScreen   = true;
+            config.enableDevConsole = true;
+            config.asyncLogging     = true;
+            config.maxLogEntries    = 50000;
+            config.timestampEnabled = true;
+            config.threadIdEnabled  = true;
+            config.autoFlush        = false;
+
+            // Enhanced smart rotation settings
+            config.enableSmartRotation = true;
+            config.rotationConfigPath  = "Data/Config/LogRotation.json";
+
+            // Configure Minecraft-style rotation settings
+            config.smartRotationConfig.maxFileSizeBytes = 100 * 1024 * 1024;
+            config.smartRotationConfig.maxTimeInterval  = std::chrono::hours(2);
+            config.smartRotationConfig.logDirectory     = "Logs";
+            config.smartRotationConfig.currentLogName   = "latest.log";
+            config.smartRotationConfig.sessionPrefix    = "session";
+        }
+    }
+    catch (nlohmann::json::exception const& e)
+    {
+        DebuggerPrintf("JSON parsing error in LogConfig.json: %s\n", e.what());
+
+        // Fallback to hardcoded defaults on error
+        config.logFilePath      = "Logs/ProtogameJS3D.log";
+        config.enableConsole    = true;
+        config.enableFile       = true;
+        config.enableDebugOut   = true;
+        config.enableOnScreen   = true;
+        config.enableDevConsole = true;
+        config.asyncLogging     = true;
+        config.maxLogEntries    = 50000;
+        config.timestampEnabled = true;
+        config.threadIdEnabled  = true;
+        config.autoFlush        = false;
+        config.enableSmartRotation = true;
+        config.rotationConfigPath  = "Data/Config/LogRotation.json";
+        config.smartRotationConfig.maxFileSizeBytes = 100 * 1024 * 1024;
+        config.smartRotationConfig.maxTimeInterval  = std::chrono::hours(2);
+        config.smartRotationConfig.logDirectory     = "Logs";
+        config.smartRotationConfig.currentLogName   = "latest.log";
+        config.smartRotationConfig.sessionPrefix    = "session";
+    }
+
+    return config;
+}
+
 //----------------------------------------------------------------------------------------------------
 void App::Startup()
 {
+    m_startupSeconds = GetCurrentTimeSeconds();
+
+    ProfilerSetThreadName("Main");
+
+    // Stages are timed on the main thread; tasks run on JobSystem workers between StartTask and WaitForTask
+    StartupSequence startup;
+    startup.BeginStage("EventSystem + GameConfig");
+
     //-Start-of-EventSystem---------------------------------------------------------------------------
 
     sEventSystemConfig constexpr sEventSystemConfig;
     g_eventSystem = new EventSystem(sEventSystemConfig);
     g_eventSystem->SubscribeEventCallbackFunction("OnCloseButtonClicked", OnCloseButtonClicked);
     g_eventSystem->SubscribeEventCallbackFunction("quit", OnCloseButtonClicked);
+    g_eventSystem->SubscribeEventCallbackFunction("scriptProfile", OnScriptProfileCommand);
 
     //-End-of-EventSystem-----------------------------------------------------------------------------
+    //------------------------------------------------------------------------------------------------
+
+    LoadGameConfig();
+
     //------------------------------------------------------------------------------------------------
     //-Start-of-JobSystem-----------------------------------------------------------------------------
 
-    // Initialize JobSystem with 3 generic worker threads and 1 I/O thread
+    startup.BeginStage("JobSystem");
+
+    // Generic workers default to one per hardware thread left after the main and I/O threads;
+    // Data/Config/JobSystemConfig.json can pin either count (a generic count of 0 means "auto")
+    int const hardwareThreadCount = static_cast<int>(std::thread::hardware_concurrency());
+    int       genericWorkerCount  = std::max(hardwareThreadCount - 2, 1);
+    int       ioWorkerCount       = 1;
+
+    try
+    {
+        std::ifstream configFile("Data/Config/JobSystemConfig.json");
+        if (configFile.is_open())
+        {
+            nlohmann::json jsonConfig;
+            configFile >> jsonConfig;
+
+            if (int const configuredGenericCount = jsonConfig.value("genericWorkerCount", 0); configuredGenericCount > 0)
+            {
+                genericWorkerCount = configuredGenericCount;
+            }
+            ioWorkerCount = std::max(jsonConfig.value("ioWorkerCount", ioWorkerCount), 1);
+        }
+    }
+    catch (nlohmann::json::exception const& e)
+    {
+        DebuggerPrintf("JSON parsing error in JobSystemConfig.json: %s\n", e.what());
+    }
+
+    DebuggerPrintf("JobSystem: %d generic workers, %d I/O workers (%d hardware threads)\n", genericWorkerCount, ioWorkerCount, hardwareThreadCount);
+
     JobSystem* jobSystem = new JobSystem();
-    jobSystem->StartUp(3, 1);
+    jobSystem->StartUp(genericWorkerCount, ioWorkerCount);
     g_jobSystem = jobSystem;  // Set global pointer for backward compatibility
 
+    SetParallelForWorkerCount(genericWorkerCount);
+
     // Initialize GEngine singleton with JobSystem
     GEngine::Get().Initialize(jobSystem);
 
+    // Nothing before the LogSubsystem needs the parsed log config, so the file read and JSON parse overlap them
+    sLogSubsystemConfig logConfig;
+    int const logConfigTask = startup.StartTask("LogConfig.json", [&logConfig] { logConfig = LoadLogSubsystemConfig(); }, true);
+
+    startup.BeginStage("Construct subsystems");
+
     //-End-of-JobSystem-------------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
     //-Start-of-InputSystem---------------------------------------------------------------------------
@@ -131,76 +287,8 @@ void App::Startup()
     //------------------------------------------------------------------------------------------------
     //-Start-of-LogSubsystem--------------------------------------------------------------------------
 
-    // Load LogSubsystem configuration from JSON file
-    sLogSubsystemConfig config;
-
-    try
-    {
-        std::ifstream configFile("Data/Config/LogConfig.json");
-        if (configFile.is_open())
-        {
-            nlohmann::json jsonConfig;
-            configFile >> jsonConfig;
-            config = sLogSubsystemConfig::FromJSON(jsonConfig);
-
-            // Simple success message (we can't use LogSubsystem yet as it's not initialized)
-            DebuggerPrintf("Loaded LogSubsystem config from JSON\n");
-        }
-        else
-        {
-            // Fallback to hardcoded defaults if JSON file not found
-            DebuggerPrintf("LogConfig.json not found, using default configuration\n");
-
-            config.logFilePath      = "Logs/ProtogameJS3D.log";
-            config.enableConsole    = true;
-            config.enableFile       = true;
-            config.enableDebugOut   = true;
-            config.enableOnScreen   = true;
-            config.enableDevConsole = true;
-            config.asyncLogging     = true;
-            config.maxLogEntries    = 50000;
-            config.timestampEnabled = true;
-            config.threadIdEnabled  = true;
-            config.autoFlush        = false;
-
-            // Enhanced smart rotation settings
-            config.enableSmartRotation = true;
-            config.rotationConfigPath  = "Data/Config/LogRotation.json";
-
-            // Configure Minecraft-style rotation settings
-            config.smartRotationConfig.maxFileSizeBytes = 100 * 1024 * 1024;
-            config.smartRotationConfig.maxTimeInterval  = std::chrono::hours(2);
-            config.smartRotationConfig.logDirectory     = "Logs";
-            config.smartRotationConfig.currentLogName   = "latest.log";
-            config.smartRotationConfig.sessionPrefix    = "session";
-        }
-    }
-    catch (nlohmann::json::exception const& e)
-    {
-        DebuggerPrintf("JSON parsing error in LogConfig.json: %s\n", e.what());
-
-        // Fallback to hardcoded defaults on error
-        config.logFilePath      = "Logs/ProtogameJS3D.log";
-        config.enableConsole    = true;
-        config.enableFile       = true;
-        config.enableDebugOut   = true;
-        config.enableOnScreen   = true;
-        config.enableDevConsole = true;
-        config.asyncLogging     = true;
-        config.maxLogEntries    = 50000;
-        config.timestampEnabled = true;
-        config.threadIdEnabled  = true;
-        config.autoFlush        = false;
-        config.enableSmartRotation = true;
-        config.rotationConfigPath  = "Data/Config/LogRotation.json";
-        config.smartRotationConfig.maxFileSizeBytes = 100 * 1024 * 1024;
-        config.smartRotationConfig.maxTimeInterval  = std::chrono::hours(2);
-        config.smartRotationConfig.logDirectory     = "Logs";
-        config.smartRotationConfig.currentLogName   = "latest.log";
-        config.smartRotationConfig.sessionPrefix    = "session";
-    }
-
-    g_logSubsystem = new LogSubsystem(config);
+    startup.WaitForTask(logConfigTask);
+    g_logSubsystem = new LogSubsystem(logConfig);
 
     //------------------------------------------------------------------------------------------------
     //-Start-of-AudioSystem---------------------------------------------------------------------------
@@ -221,13 +309,19 @@ void App::Startup()
     //------------------------------------------------------------------------------------------------
     //-Start-of-ScriptSubsystem-----------------------------------------------------------------------
 
+    // See ScriptRuntimeProfile.hpp: production and sampling leave out the debugging machinery
+    m_scriptRuntimeProfile                        = LoadScriptRuntimeProfile("Data/Config/WebSocketConfig.json");
+    m_launchedScriptFeatures                      = GetScriptRuntimeFeatures(m_scriptRuntimeProfile);
+    m_launchedScriptFeatures.m_isInspectorEnabled = m_launchedScriptFeatures.m_isInspectorEnabled && m_benchmarkOptions.m_isDevToolsEnabled;
+    m_isScriptRegistryEnabled                     = m_launchedScriptFeatures.m_isScriptRegistryEnabled;
+
     sScriptSubsystemConfig scriptConfig;
-    scriptConfig.enableDebugging     = true;
+    scriptConfig.enableDebugging     = m_launchedScriptFeatures.m_isDebuggingEnabled;
     scriptConfig.heapSizeLimit       = 256;
     scriptConfig.enableConsoleOutput = true;
-    scriptConfig.enableHotReload     = true;
+    scriptConfig.enableHotReload     = m_launchedScriptFeatures.m_isHotReloadEnabled;
     // Chrome DevTools Inspector Configuration
-    scriptConfig.enableInspector = true;  // Enable Chrome DevTools integration
+    scriptConfig.enableInspector = m_launchedScriptFeatures.m_isInspectorEnabled;  // Enable Chrome DevTools integration (-noDevTools turns it off)
     scriptConfig.inspectorPort   = 9229;  // Chrome DevTools connection port
     scriptConfig.inspectorHost   = "127.0.0.1"; // Inspector server bind address
     scriptConfig.waitForDebugger = false; // Don't pause execution waiting for debugger
@@ -236,28 +330,65 @@ void App::Startup()
     //-End-of-ScriptSubsystem-------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
 
+    startup.BeginStage("Window");
+
     g_logSubsystem->Startup();
     g_eventSystem->Startup();
     g_window->Startup();
 
+    // The swapchain still presents every frame, so draw cost is measured; there is just nothing on screen
+    if (IsHeadless())
+    {
+        ShowWindow(static_cast<HWND>(g_window->GetWindowHandle()), SW_HIDE);
+    }
+
+    // Audio only has to be up once the game and its script bindings exist; it initialises while the device,
+    // resources and V8 start on the main thread
+    int const audioTask = startup.StartTask("AudioSystem::Startup", [] { g_audio->Startup(); });
+
+    startup.BeginStage("Renderer");
     g_renderer->Startup();
     ResourceSubsystem::Initialize(g_renderer);
+
+    startup.BeginStage("DebugRender + DevConsole + Input");
     DebugRenderSystemStartup(sDebugRenderConfig);
     g_devConsole->StartUp();
     g_input->Startup();
-    g_audio->Startup();
+
+    startup.BeginStage("ResourceSubsystem");
     g_resourceSubsystem->Startup();  // Keep the old instance for backward compatibility
+
+    startup.BeginStage("ScriptSubsystem");
     g_scriptSubsystem->Startup();
 
     g_logSubsystem->RegisterCategory("LogApp", eLogVerbosity::Log, eLogVerbosity::All);
     g_logSubsystem->RegisterCategory("LogGame", eLogVerbosity::Log, eLogVerbosity::All);
+    DeferredLogStartup();
 
+    startup.BeginStage("BitmapFont");
     // g_bitmapFont = g_renderer->CreateOrGetBitmapFontFromFile("Data/Fonts/DaemonFont"); // DO NOT SPECIFY FILE .EXTENSION!!  (Important later on.)
     g_bitmapFont = ResourceSubsystem::CreateOrGetBitmapFontFromFile("Data/Fonts/DaemonFont"); // DO NOT SPECIFY FILE .EXTENSION!!  (Important later on.)
+
+    startup.WaitForTask(audioTask);
+    startup.WaitForAllTasks();     // Before the game can submit jobs of its own
+
+    startup.BeginStage("Game");
+    GUARANTEE_OR_DIE(m_replaySession.Startup(m_replayOptions), StringFormat("(App::Startup)(could not open {} to {})", m_replayOptions.m_path, GetReplayModeName(m_replayOptions.m_mode)))
     g_rng        = new RandomNumberGenerator();
     g_game       = new Game();
+    g_game->SetPipelinedRendering(m_isPipelinedRendering);
     SetupScriptingBindings();
+
+    startup.BeginStage("Game::PostInit (main.mjs)");
     g_game->PostInit();
+
+    // Off by default: a synchronous extra script on every launch only adds to time-to-first-frame
+    if (m_isStartupTestScriptEnabled)
+    {
+        g_game->RunStartupTestScript();
+    }
+
+    startup.Finish();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -286,6 +417,7 @@ void App::Shutdown()
     // Destroy all Engine Subsystem in reverse order
     GAME_SAFE_RELEASE(g_game);
     GAME_SAFE_RELEASE(g_rng);
+    m_replaySession.Shutdown();
 
     // Shutdown subsystems in reverse order of initialization
     g_audio->Shutdown();
@@ -323,6 +455,8 @@ void App::Shutdown()
     // Shutdown GEngine singleton and JobSystem
     GEngine::Get().Shutdown();
 
+    ShutdownParallelFor();
+
     if (g_jobSystem)
     {
         g_jobSystem->ShutDown();
@@ -333,6 +467,7 @@ void App::Shutdown()
     // Shutdown and delete LogSubsystem last
     if (g_logSubsystem)
     {
+        DeferredLogShutdown();
         g_logSubsystem->Shutdown();
         delete g_logSubsystem;
         g_logSubsystem = nullptr;
@@ -344,6 +479,8 @@ void App::Shutdown()
 //
 void App::RunFrame()
 {
+    PROFILE_SCOPE("Frame");
+
     BeginFrame();   // Engine pre-frame stuff
     Update();       // Game updates / moves / spawns / hurts / kills stuff
     Render();       // Game draws current state of things
@@ -356,8 +493,22 @@ void App::RunMainLoop()
     // Program main loop; keep running frames until it's time to quit
     while (!m_isQuitting)
     {
-        // Sleep(16); // Temporary code to "slow down" our app to ~60Hz until we have proper frame timing in
         RunFrame();
+        m_replaySession.EndFrame();
+        ProfilerEndFrame();
+        AllocationTrackerEndFrame();
+
+        // Before the wait, so a due collection can use the time the scheduler was about to sleep
+        m_idleGarbageCollector.Update(m_frameScheduler.GetIdleSecondsBeforeNextFrame());
+
+        if (m_startupSeconds > 0.0)
+        {
+            DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(App::RunMainLoop)(first frame done {:.1f} ms after startup began)", (GetCurrentTimeSeconds() - m_startupSeconds) * 1000.0));
+            m_startupSeconds = 0.0;
+        }
+
+        PROFILE_SCOPE("WaitForNextFrame");
+        m_frameScheduler.WaitForNextFrame();
     }
 }
 
@@ -371,6 +522,30 @@ STATIC bool App::OnCloseButtonClicked(EventArgs& args)
     return true;
 }
 
+//----------------------------------------------------------------------------------------------------
+// Console: scriptProfile profile=production|sampling|debugging (no argument prints the current profile)
+STATIC bool App::OnScriptProfileCommand(EventArgs& args)
+{
+    String const          name    = args.GetValue("profile", String());
+    eScriptRuntimeProfile profile = g_app->GetScriptRuntimeProfile();
+
+    if (!name.empty() && !ParseScriptRuntimeProfile(name, profile))
+    {
+        g_devConsole->AddLine(DevConsole::INFO_MINOR, StringFormat("Unknown script profile \"{}\" (production, sampling, debugging)", name));
+        return false;
+    }
+
+    bool const isApplied = name.empty() || g_app->SetScriptRuntimeProfile(profile);
+
+    // Always the launched profile: a switch that needs a restart only changes the script registry
+    g_devConsole->AddLine(DevConsole::INFO_MINOR, StringFormat("Script profile: {} (script registry {})", GetScriptRuntimeProfileName(g_app->GetScriptRuntimeProfile()), g_app->IsScriptRegistryEnabled() ? "on" : "off"));
+    if (!isApplied)
+    {
+        g_devConsole->AddLine(DevConsole::INFO_MINOR, StringFormat("Inspector, debugging and hot reload switch to {} on the next launch: set scriptRuntime.profile in WebSocketConfig.json", GetScriptRuntimeProfileName(profile)));
+    }
+    return true;
+}
+
 //----------------------------------------------------------------------------------------------------
 STATIC void App::RequestQuit()
 {
@@ -380,6 +555,9 @@ STATIC void App::RequestQuit()
 //----------------------------------------------------------------------------------------------------
 void App::BeginFrame() const
 {
+    PROFILE_SCOPE("App::BeginFrame");
+    ALLOCATION_TAG("Engine");
+
     g_eventSystem->BeginFrame();
     g_window->BeginFrame();
     g_renderer->BeginFrame();
@@ -392,16 +570,25 @@ void App::BeginFrame() const
 //----------------------------------------------------------------------------------------------------
 void App::Update()
 {
+    PROFILE_SCOPE("App::Update");
+
     Clock::TickSystemClock();
     UpdateCursorMode();
 
+    // After the engine's BeginFrame pumped the window messages, so recording sees this frame's keys and replay
+    // overrides them
+    m_replaySession.BeginFrame();
+
     // Process pending hot-reload events on main thread (V8-safe)
     if (g_scriptSubsystem)
     {
+        PROFILE_SCOPE("ScriptSubsystem::Update");
+        ALLOCATION_TAG("Script");
         g_scriptSubsystem->Update();
     }
 
-    g_game->UpdateJS();
+    double const frameSeconds = m_replaySession.SyncFrameSeconds(Clock::GetSystemClock().GetDeltaSeconds());
+    g_game->UpdateJS(m_frameScheduler.AdvanceSimulation(frameSeconds));
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -413,6 +600,8 @@ void App::Update()
 //
 void App::Render() const
 {
+    PROFILE_SCOPE("App::Render");
+
     Rgba8 const clearColor = Rgba8::GREY;
 
     g_renderer->ClearScreen(clearColor, Rgba8::BLACK);
@@ -426,6 +615,9 @@ void App::Render() const
 //----------------------------------------------------------------------------------------------------
 void App::EndFrame() const
 {
+    PROFILE_SCOPE("App::EndFrame");
+    ALLOCATION_TAG("Engine");
+
     g_eventSystem->EndFrame();
     g_window->EndFrame();
     g_renderer->EndFrame();
@@ -486,6 +678,145 @@ std::any App::OnGarbageCollection(std::vector<std::any> const& args)
     return std::any{};
 }
 
+//----------------------------------------------------------------------------------------------------
+// Only the settings the code reads are picked up; anything missing keeps its default
+void App::LoadGameConfig()
+{
+    sFrameSchedulerConfig       frameSchedulerConfig;
+    sIdleGarbageCollectorConfig idleGarbageCollectorConfig;
+
+    tinyxml2::XMLDocument gameConfig;
+    if (gameConfig.LoadFile("Data/GameConfig.xml") != tinyxml2::XML_SUCCESS || gameConfig.RootElement() == nullptr)
+    {
+        DebuggerPrintf("GameConfig.xml not found or invalid, using default configuration\n");
+    }
+    else
+    {
+        tinyxml2::XMLElement const* root = gameConfig.RootElement();
+
+        if (tinyxml2::XMLElement const* pipelinedRendering = root->FirstChildElement("pipelinedRendering"))
+        {
+            pipelinedRendering->QueryBoolText(&m_isPipelinedRendering);
+        }
+        if (tinyxml2::XMLElement const* runStartupTestScript = root->FirstChildElement("runStartupTestScript"))
+        {
+            runStartupTestScript->QueryBoolText(&m_isStartupTestScriptEnabled);
+        }
+        if (tinyxml2::XMLElement const* targetFrameRate = root->FirstChildElement("targetFrameRate"))
+        {
+            targetFrameRate->QueryFloatText(&frameSchedulerConfig.m_targetFrameRate);
+        }
+        if (tinyxml2::XMLElement const* vsync = root->FirstChildElement("vsync"))
+        {
+            vsync->QueryBoolText(&frameSchedulerConfig.m_isVSyncEnabled);
+        }
+        if (tinyxml2::XMLElement const* fixedTimestepHz = root->FirstChildElement("fixedTimestepHz"))
+        {
+            fixedTimestepHz->QueryFloatText(&frameSchedulerConfig.m_fixedTimestepHz);
+        }
+        if (tinyxml2::XMLElement const* idleGcIntervalSeconds = root->FirstChildElement("idleGcIntervalSeconds"))
+        {
+            idleGcIntervalSeconds->QueryFloatText(&idleGarbageCollectorConfig.m_intervalSeconds);
+        }
+    }
+
+    // Benchmarks measure how long a frame takes, not how long the scheduler waits for the next one; a replay
+    // runs on its recorded deltas, so it goes as fast as the simulation can
+    if (IsHeadless())
+    {
+        frameSchedulerConfig.m_targetFrameRate = 0.f;
+        frameSchedulerConfig.m_isVSyncEnabled  = false;
+    }
+
+    m_frameScheduler.Startup(frameSchedulerConfig);
+    m_idleGarbageCollector.Startup(idleGarbageCollectorConfig);
+
+    DebuggerPrintf("GameConfig: pipelinedRendering=%s, runStartupTestScript=%s, targetFrameRate=%.1f, vsync=%s, fixedTimestepHz=%.1f, idleGcIntervalSeconds=%.1f\n",
+                   m_isPipelinedRendering ? "true" : "false",
+                   m_isStartupTestScriptEnabled ? "true" : "false",
+                   frameSchedulerConfig.m_targetFrameRate,
+                   frameSchedulerConfig.m_isVSyncEnabled ? "true" : "false",
+                   frameSchedulerConfig.m_fixedTimestepHz,
+                   idleGarbageCollectorConfig.m_intervalSeconds);
+}
+
+//----------------------------------------------------------------------------------------------------
+sIdleGarbageCollectorStats const& App::GetIdleGarbageCollectorStats() const
+{
+    return m_idleGarbageCollector.GetStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+eScriptRuntimeProfile App::GetScriptRuntimeProfile() const
+{
+    return m_scriptRuntimeProfile;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool App::IsScriptRegistryEnabled() const
+{
+    return m_isScriptRegistryEnabled;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The script registry follows the new profile at once; the ScriptSubsystem settings need a restart, so the
+// reported profile stays the launched one unless the registry was the only difference
+//
+bool App::SetScriptRuntimeProfile(eScriptRuntimeProfile const profile)
+{
+    sScriptRuntimeFeatures const features          = GetScriptRuntimeFeatures(profile);
+    bool const                   isInspectorWanted = features.m_isInspectorEnabled && m_benchmarkOptions.m_isDevToolsEnabled;
+    bool const                   isRestartNeeded   = isInspectorWanted != m_launchedScriptFeatures.m_isInspectorEnabled ||
+                                                     features.m_isDebuggingEnabled != m_launchedScriptFeatures.m_isDebuggingEnabled ||
+                                                     features.m_isHotReloadEnabled != m_launchedScriptFeatures.m_isHotReloadEnabled;
+
+    m_isScriptRegistryEnabled = features.m_isScriptRegistryEnabled;
+    if (!isRestartNeeded)
+    {
+        m_scriptRuntimeProfile = profile;
+    }
+
+    DAEMON_LOG(LogScript, eLogVerbosity::Display, StringFormat("(App::SetScriptRuntimeProfile)({}){}", GetScriptRuntimeProfileName(profile), isRestartNeeded ? "(inspector, debugging and hot reload change on the next launch; set scriptRuntime.profile in WebSocketConfig.json)" : ""));
+
+    return !isRestartNeeded;
+}
+
+//----------------------------------------------------------------------------------------------------
+sBenchmarkOptions const& App::GetBenchmarkOptions() const
+{
+    return m_benchmarkOptions;
+}
+
+//----------------------------------------------------------------------------------------------------
+ReplaySession& App::GetReplaySession()
+{
+    return m_replaySession;
+}
+
+//----------------------------------------------------------------------------------------------------
+// -benchmark and -replay: no window on screen and no frame pacing
+bool App::IsHeadless() const
+{
+    return m_benchmarkOptions.m_isEnabled || m_replayOptions.m_mode == eReplayMode::REPLAY;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Non-zero only when a command-line check failed, so a benchmark or replay run can fail a CI step
+int App::GetExitCode() const
+{
+    if (m_benchmarkOptions.m_allocationBudget >= 0 && AllocationTrackerGetOverBudgetFrameCount() > 0)
+    {
+        return 3;
+    }
+
+    if (m_replaySession.GetDesyncFrame() >= 0)
+    {
+        return 4;
+    }
+
+    return 0;
+}
+
 //----------------------------------------------------------------------------------------------------
 void App::UpdateCursorMode()
 {
@@ -510,15 +841,20 @@ void App::SetupScriptingBindings()
 
     DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(App::SetupScriptingBindings)(start)"));
 
+    DAEMON_LOG(LogScript, eLogVerbosity::Display, StringFormat("(App::SetupScriptingBindings)(script runtime profile: {})(inspector {}, debugging {}, hot reload {})", GetScriptRuntimeProfileName(m_scriptRuntimeProfile), m_launchedScriptFeatures.m_isInspectorEnabled ? "on" : "off", m_launchedScriptFeatures.m_isDebuggingEnabled ? "on" : "off", m_launchedScriptFeatures.m_isHotReloadEnabled ? "on" : "off"));
+
     // Initialize hot-reload system (now integrated into ScriptSubsystem)
-    std::string projectRoot = "C:/p4/Personal/SD/ProtogameJS3D/";
-    if (g_scriptSubsystem->InitializeHotReload(projectRoot))
+    if (m_launchedScriptFeatures.m_isHotReloadEnabled)
     {
-        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(App::SetupScriptingBindings) Hot-reload system initialized successfully"));
-    }
-    else
-    {
-        DAEMON_LOG(LogScript, eLogVerbosity::Warning, StringFormat("(App::SetupScriptingBindings) Hot-reload system initialization failed"));
+        std::string projectRoot = "C:/p4/Personal/SD/ProtogameJS3D/";
+        if (g_scriptSubsystem->InitializeHotReload(projectRoot))
+        {
+            DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(App::SetupScriptingBindings) Hot-reload system initialized successfully"));
+        }
+        else
+        {
+            DAEMON_LOG(LogScript, eLogVerbosity::Warning, StringFormat("(App::SetupScriptingBindings) Hot-reload system initialization failed"));
+        }
     }
 
     m_gameScriptInterface = std::make_shared<GameScriptInterface>(g_game);
@@ -6,7 +6,12 @@
 #pragma once
 #include <memory>
 
+#include "Game/Framework/BenchmarkSupport.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
 #include "Game/Framework/GameScriptInterface.hpp"
+#include "Game/Framework/IdleGarbageCollector.hpp"
+#include "Game/Framework/ReplaySession.hpp"
+#include "Game/Framework/ScriptRuntimeProfile.hpp"
 
 #include "Engine/Audio/AudioScriptInterface.hpp"
 #include "Engine/Core/EventSystem.hpp"
@@ -22,6 +27,7 @@ public:
     App()  = default;
     ~App() = default;
 
+    void ParseCommandLine(String const& commandLine);
     void Startup();
     void Shutdown();
     void RunFrame();
@@ -29,9 +35,21 @@ public:
     void RunMainLoop();
 
     static bool OnCloseButtonClicked(EventArgs& args);
+    static bool OnScriptProfileCommand(EventArgs& args);
     static void RequestQuit();
     static bool m_isQuitting;
 
+    sBenchmarkOptions const& GetBenchmarkOptions() const;
+    ReplaySession&           GetReplaySession();
+    bool                     IsHeadless() const;
+    int                      GetExitCode() const;
+
+    sIdleGarbageCollectorStats const& GetIdleGarbageCollectorStats() const;
+
+    eScriptRuntimeProfile GetScriptRuntimeProfile() const;                            // The one actually running
+    bool                  IsScriptRegistryEnabled() const;
+    bool                  SetScriptRuntimeProfile(eScriptRuntimeProfile profile);     // False if part of it waits for a restart
+
 private:
     void BeginFrame() const;
     void Update();
@@ -42,6 +60,7 @@ private:
     static std::any OnDebug(std::vector<std::any> const& args);
     static std::any OnGarbageCollection(std::vector<std::any> const& args);
 
+    void LoadGameConfig();
     void UpdateCursorMode();
     void SetupScriptingBindings();
 
@@ -49,4 +68,15 @@ private:
     std::shared_ptr<GameScriptInterface>   m_gameScriptInterface;
     std::shared_ptr<InputScriptInterface>  m_inputScriptInterface;
     std::shared_ptr<AudioScriptInterface>  m_audioScriptInterface;
+    FrameScheduler                         m_frameScheduler;
+    IdleGarbageCollector                   m_idleGarbageCollector;
+    bool                                   m_isPipelinedRendering       = false;     // GameConfig.xml <pipelinedRendering>
+    bool                                   m_isStartupTestScriptEnabled = false;     // GameConfig.xml <runStartupTestScript>
+    sBenchmarkOptions                      m_benchmarkOptions;                       // Command line, see BenchmarkSupport.hpp
+    sReplayOptions                         m_replayOptions;                          // Command line, see ReplaySession.hpp
+    ReplaySession                          m_replaySession;
+    eScriptRuntimeProfile                  m_scriptRuntimeProfile       = eScriptRuntimeProfile::DEBUGGING;     // WebSocketConfig.json; the console only without a restart
+    sScriptRuntimeFeatures                 m_launchedScriptFeatures;                 // What the ScriptSubsystem was started with
+    bool                                   m_isScriptRegistryEnabled    = true;      // The launched profile's, then the console's
+    double                                 m_startupSeconds             = 0.0;       // Cleared once the first frame is logged
 };
@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------------------------------
+// BenchmarkSupport.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/BenchmarkSupport.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+//----------------------------------------------------------------------------------------------------
+sBenchmarkOptions ParseBenchmarkOptions(String const& commandLine)
+{
+    sBenchmarkOptions options;
+
+    std::istringstream tokens(commandLine);
+    String             token;
+    String const       reportPrefix = "-benchmarkReport=";
+    String const       budgetPrefix = "-allocationBudget=";
+
+    while (tokens >> token)
+    {
+        if (token == "-benchmark")
+        {
+            options.m_isEnabled = true;
+        }
+        else if (token == "-noDevTools")
+        {
+            options.m_isDevToolsEnabled = false;
+        }
+        else if (token.rfind(reportPrefix, 0) == 0 && token.size() > reportPrefix.size())
+        {
+            options.m_reportPath = token.substr(reportPrefix.size());
+        }
+        else if (token.rfind(budgetPrefix, 0) == 0 && token.size() > budgetPrefix.size())
+        {
+            options.m_allocationBudget = std::atoi(token.c_str() + budgetPrefix.size());
+        }
+    }
+
+    return options;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t GetProcessPrivateBytes()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS_EX counters = {};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters)))
+    {
+        return counters.PrivateUsage;
+    }
+#endif
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool WriteBenchmarkTextFile(String const& path, String const& text)
+{
+    std::error_code             error;
+    std::filesystem::path const filePath(path);
+
+    if (filePath.has_parent_path())
+    {
+        std::filesystem::create_directories(filePath.parent_path(), error);
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    file.write(text.data(), static_cast<std::streamsize>(text.size()));
+
+    return static_cast<bool>(file);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool TouchBenchmarkFile(String const& path)
+{
+    std::error_code error;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+
+    return !error;
+}
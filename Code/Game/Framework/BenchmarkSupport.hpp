@@ -0,0 +1,41 @@
+//----------------------------------------------------------------------------------------------------
+// BenchmarkSupport.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// Headless benchmark mode, started from the command line:
+//
+//   ProtogameJS3D.exe -benchmark [-noDevTools] [-benchmarkReport=Logs/BenchmarkReport.json] [-allocationBudget=N]
+//
+// App hides the window and turns frame pacing off; the scenarios themselves run in script
+// (Data/Scripts/components/BenchmarkRunner.js), which writes the report and quits when done.
+// -noDevTools starts V8 without the Chrome DevTools inspector, so runs with and without it can be compared.
+// -allocationBudget=N fails the run (non-zero exit code) if a measured frame makes more than N heap allocations;
+// see AllocationTracker.hpp.
+//
+struct sBenchmarkOptions
+{
+    bool   m_isEnabled         = false;
+    bool   m_isDevToolsEnabled = true;
+    String m_reportPath        = "Logs/BenchmarkReport.json";
+    int    m_allocationBudget  = -1;     // Allocations per frame; < 0 for none
+};
+
+//----------------------------------------------------------------------------------------------------
+sBenchmarkOptions ParseBenchmarkOptions(String const& commandLine);
+
+// Private (committed) bytes of this process; 0 where unsupported
+uint64_t GetProcessPrivateBytes();
+
+// Creates missing parent directories; false if the file could not be written
+bool WriteBenchmarkTextFile(String const& path, String const& text);
+
+// Bumps the file's modification time so the script hot-reload watcher picks it up; the contents are untouched
+bool TouchBenchmarkFile(String const& path);
@@ -0,0 +1,158 @@
+//----------------------------------------------------------------------------------------------------
+// DebugTextOverlay.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/DebugTextOverlay.hpp"
+
+#include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/Profiler.hpp"
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+DebugTextOverlay::DebugTextOverlay(BitmapFont& font)
+    : m_font(font)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+DebugTextOverlay::~DebugTextOverlay()
+{
+    GAME_SAFE_RELEASE(m_vertexBuffer);
+}
+
+//----------------------------------------------------------------------------------------------------
+int DebugTextOverlay::AddLine(Vec2 const&  textMins,
+                              float const  cellHeight,
+                              Rgba8 const& color)
+{
+    sOverlayLine line;
+    line.m_textMins   = textMins;
+    line.m_cellHeight = cellHeight;
+    line.m_color      = color;
+    m_lines.push_back(std::move(line));
+
+    return static_cast<int>(m_lines.size()) - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebugTextOverlay::SetText(int const     line,
+                               String const& text)
+{
+    m_lines[line].m_format = nullptr;     // The next SetLine formats, whatever its values
+    ApplyText(line, text);
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebugTextOverlay::ApplyText(int const     line,
+                                 String const& text)
+{
+    sOverlayLine& overlayLine = m_lines[line];
+    if (overlayLine.m_text == text)
+    {
+        return;
+    }
+
+    overlayLine.m_text    = text;
+    overlayLine.m_isDirty = true;
+    m_isDirty             = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebugTextOverlay::SetColor(int const    line,
+                                Rgba8 const& color)
+{
+    sOverlayLine& overlayLine = m_lines[line];
+    if (overlayLine.m_color.r == color.r && overlayLine.m_color.g == color.g && overlayLine.m_color.b == color.b && overlayLine.m_color.a == color.a)
+    {
+        return;
+    }
+
+    overlayLine.m_color   = color;
+    overlayLine.m_isDirty = true;
+    m_isDirty             = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool DebugTextOverlay::HaveValuesChanged(int const           line,
+                                         char const*         format,
+                                         double const* const values,
+                                         int const           valueCount)
+{
+    sOverlayLine& overlayLine = m_lines[line];
+
+    if (overlayLine.m_format == format && std::equal(values, values + valueCount, overlayLine.m_values.begin()))
+    {
+        return false;
+    }
+
+    overlayLine.m_format = format;
+    std::copy(values, values + valueCount, overlayLine.m_values.begin());
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DebugTextOverlay::Render()
+{
+    if (m_isDirty)
+    {
+        PROFILE_SCOPE("DebugTextOverlay::Rebuild");
+
+        m_verts.clear();
+
+        for (sOverlayLine& line : m_lines)
+        {
+            if (line.m_isDirty)
+            {
+                line.m_verts.clear();
+                m_font.AddVertsForText2D(line.m_verts, line.m_textMins, line.m_cellHeight, line.m_text, line.m_color);
+                line.m_isDirty = false;
+            }
+
+            m_verts.insert(m_verts.end(), line.m_verts.begin(), line.m_verts.end());
+        }
+
+        unsigned int const stride = sizeof(Vertex_PCU);
+        unsigned int const size   = static_cast<unsigned int>(m_verts.size()) * stride;
+
+        if (size > m_vertexBufferBytes)
+        {
+            // Grown with headroom so a line getting a few characters longer does not recreate it
+            GAME_SAFE_RELEASE(m_vertexBuffer);
+            m_vertexBufferBytes = std::max(size * 2, 4096u * stride);
+            m_vertexBuffer      = g_renderer->CreateVertexBuffer(m_vertexBufferBytes, stride);
+        }
+
+        if (size > 0)
+        {
+            g_renderer->CopyCPUToGPU(m_verts.data(), size, m_vertexBuffer);
+        }
+
+        m_isDirty = false;
+        ++m_rebuildCount;
+    }
+
+    if (m_verts.empty())
+    {
+        return;
+    }
+
+    g_renderer->SetModelConstants();
+    g_renderer->SetBlendMode(eBlendMode::ALPHA);
+    g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_NONE);
+    g_renderer->SetSamplerMode(eSamplerMode::POINT_CLAMP);
+    g_renderer->SetDepthMode(eDepthMode::DISABLED);
+    g_renderer->BindTexture(&m_font.GetTexture());
+    g_renderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
+    g_renderer->DrawVertexBuffer(m_vertexBuffer, static_cast<unsigned int>(m_verts.size()));
+}
+
+//----------------------------------------------------------------------------------------------------
+int DebugTextOverlay::GetRebuildCount() const
+{
+    return m_rebuildCount;
+}
@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------------------------------
+// DebugTextOverlay.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+
+#include <array>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+class BitmapFont;
+class VertexBuffer;
+
+//----------------------------------------------------------------------------------------------------
+// Retained screen-space text for stats that are on all the time.
+//
+// A line is added once with its position, size and color, and gets new text through SetText() or SetLine().
+// SetLine(line, "FPS: %.2f", fps) only formats when the values differ from the last call. SetText() only
+// re-tessellates when the text differs. Render() rebuilds the shared vertex array only if a line changed,
+// uploads it to one dynamic vertex buffer, and draws every line in a single call. A frame where nothing
+// changed costs one draw and no string or glyph work. DebugAddScreenText, by contrast, formats and builds
+// quads for every line, every frame.
+//
+// Render() belongs inside a screen camera pass. Lines with empty text draw nothing.
+//
+class DebugTextOverlay
+{
+public:
+    static constexpr int MAX_LINE_VALUES = 6;
+
+    explicit DebugTextOverlay(BitmapFont& font);
+    ~DebugTextOverlay();
+
+    DebugTextOverlay(DebugTextOverlay const&)            = delete;
+    DebugTextOverlay& operator=(DebugTextOverlay const&) = delete;
+
+    int  AddLine(Vec2 const& textMins, float cellHeight, Rgba8 const& color = Rgba8::WHITE);
+    void SetText(int line, String const& text);
+    void SetColor(int line, Rgba8 const& color);
+
+    // Printf-style; the numeric values are kept and compared so an unchanged line is not formatted at all
+    template <typename... Values>
+    void SetLine(int line, char const* format, Values... values);
+
+    void Render();
+
+    int GetRebuildCount() const;     // Frames that re-tessellated; stays flat while the text is unchanged
+
+private:
+    struct sOverlayLine
+    {
+        Vec2                                 m_textMins   = Vec2::ZERO;
+        float                                m_cellHeight = 0.f;
+        Rgba8                                m_color;
+        String                               m_text;
+        char const*                          m_format     = nullptr;
+        std::array<double, MAX_LINE_VALUES>  m_values     = {};
+        VertexList_PCU                       m_verts;
+        bool                                 m_isDirty    = true;
+    };
+
+    void ApplyText(int line, String const& text);
+    bool HaveValuesChanged(int line, char const* format, double const* values, int valueCount);
+
+    BitmapFont&               m_font;
+    std::vector<sOverlayLine> m_lines;
+    VertexList_PCU            m_verts;                  // Every line, in order; what the vertex buffer holds
+    VertexBuffer*             m_vertexBuffer      = nullptr;
+    unsigned int              m_vertexBufferBytes = 0;
+    bool                      m_isDirty           = false;
+    int                       m_rebuildCount      = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename... Values>
+void DebugTextOverlay::SetLine(int const line, char const* format, Values... values)
+{
+    static_assert(sizeof...(Values) <= MAX_LINE_VALUES, "DebugTextOverlay::SetLine: too many values");
+
+    double const valueArray[sizeof...(Values) + 1] = {static_cast<double>(values)..., 0.0};
+    if (HaveValuesChanged(line, format, valueArray, static_cast<int>(sizeof...(Values))))
+    {
+        ApplyText(line, Stringf(format, values...));
+    }
+}
@@ -0,0 +1,203 @@
+//----------------------------------------------------------------------------------------------------
+// DeferredLog.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/DeferredLog.hpp"
+
+#include "Game/Framework/Profiler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <mutex>
+#include <thread>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    constexpr int    MAX_CATEGORIES = 32;
+    constexpr size_t RING_CAPACITY  = 4096;     // Power of two
+
+    //------------------------------------------------------------------------------------------------
+    struct sDeferredLogCategory
+    {
+        char const*      m_name = nullptr;
+        std::atomic<int> m_verbosity{static_cast<int>(eLogVerbosity::Log)};
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Bounded MPSC ring: each slot's sequence number says whether it is free for the producer at that position
+    // (sequence == position) or holds a record for the consumer (sequence == position + 1).
+    struct sDeferredLogSlot
+    {
+        std::atomic<size_t> m_sequence{0};
+        sDeferredLogRecord  m_record;
+    };
+
+    sDeferredLogCategory s_categories[MAX_CATEGORIES];
+    int                  s_categoryCount = 0;
+    std::mutex           s_categoryMutex;
+
+    sDeferredLogSlot    s_slots[RING_CAPACITY];
+    std::atomic<size_t> s_writePosition{0};
+    size_t              s_readPosition = 0;     // Drain thread only (main thread once it has been joined)
+    std::atomic<int>    s_droppedCount{0};
+
+    std::thread       s_drainThread;
+    std::atomic<bool> s_isDraining{false};     // Also gates DeferredLogIsEnabled: nothing is queued outside Startup/Shutdown
+
+    //------------------------------------------------------------------------------------------------
+    int FindCategoryLocked(char const* name)
+    {
+        for (int i = 0; i < s_categoryCount; ++i)
+        {
+            if (std::strcmp(s_categories[i].m_name, name) == 0)
+            {
+                return i;
+            }
+        }
+
+        if (s_categoryCount == MAX_CATEGORIES)
+        {
+            return -1;
+        }
+
+        s_categories[s_categoryCount].m_name = name;
+        return s_categoryCount++;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool PopAndWriteRecord()
+    {
+        sDeferredLogSlot& slot = s_slots[s_readPosition & (RING_CAPACITY - 1)];
+        if (slot.m_sequence.load(std::memory_order_acquire) != s_readPosition + 1)
+        {
+            return false;
+        }
+
+        sDeferredLogRecord const& record = slot.m_record;
+
+        // The format string is only checked here, on the drain thread; a bad one must not take the process down
+        try
+        {
+            record.m_sink(record.m_formatter(record.m_format, record.m_payload));
+        }
+        catch (std::format_error const& error)
+        {
+            record.m_sink(String("(DeferredLog)(format error: ") + error.what() + ")(format: " + record.m_format + ")");
+        }
+
+        slot.m_sequence.store(s_readPosition + RING_CAPACITY, std::memory_order_release);
+        ++s_readPosition;
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void DrainThreadMain()
+    {
+        ProfilerSetThreadName("DeferredLog");
+
+        while (s_isDraining.load(std::memory_order_acquire))
+        {
+            if (!PopAndWriteRecord())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void DeferredLogStartup()
+{
+    for (size_t i = 0; i < RING_CAPACITY; ++i)
+    {
+        s_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+    s_writePosition.store(0, std::memory_order_relaxed);
+    s_readPosition = 0;
+
+    s_isDraining.store(true, std::memory_order_release);
+    s_drainThread = std::thread(DrainThreadMain);
+}
+
+//----------------------------------------------------------------------------------------------------
+void DeferredLogShutdown()
+{
+    if (!s_drainThread.joinable())
+    {
+        return;
+    }
+
+    s_isDraining.store(false, std::memory_order_release);
+    s_drainThread.join();
+
+    // Lines pushed while the thread was stopping
+    while (PopAndWriteRecord())
+    {
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int DeferredLogFindCategory(char const* name)
+{
+    std::scoped_lock const lock(s_categoryMutex);
+    return FindCategoryLocked(name);
+}
+
+//----------------------------------------------------------------------------------------------------
+void DeferredLogSetCategoryVerbosity(char const* name, eLogVerbosity const verbosity)
+{
+    std::scoped_lock const lock(s_categoryMutex);
+    if (int const category = FindCategoryLocked(name); category >= 0)
+    {
+        s_categories[category].m_verbosity.store(static_cast<int>(verbosity), std::memory_order_relaxed);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool DeferredLogIsEnabled(int const category, eLogVerbosity const verbosity)
+{
+    // Sites past the category table log at the default level
+    int const maxVerbosity = category >= 0 ? s_categories[category].m_verbosity.load(std::memory_order_relaxed) : static_cast<int>(eLogVerbosity::Log);
+    return s_isDraining.load(std::memory_order_relaxed) && static_cast<int>(verbosity) <= maxVerbosity;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool DeferredLogPushRecord(sDeferredLogRecord const& record)
+{
+    size_t position = s_writePosition.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        sDeferredLogSlot& slot     = s_slots[position & (RING_CAPACITY - 1)];
+        size_t const      sequence = slot.m_sequence.load(std::memory_order_acquire);
+
+        if (sequence == position)
+        {
+            if (s_writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                slot.m_record = record;
+                slot.m_sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (sequence < position)
+        {
+            s_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            position = s_writePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int DeferredLogGetDroppedCount()
+{
+    return s_droppedCount.load(std::memory_order_relaxed);
+}
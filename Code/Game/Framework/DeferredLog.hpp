@@ -0,0 +1,190 @@
+//----------------------------------------------------------------------------------------------------
+// DeferredLog.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//----------------------------------------------------------------------------------------------------
+// Logging for hot paths, where DAEMON_LOG would format a string on the calling thread every time.
+//
+// DEFERRED_LOG(LogGame, eLogVerbosity::Log, "(Class::Method)(x: {})", x) takes the same arguments as DAEMON_LOG
+// with a StringFormat message, split out. Nothing is evaluated unless the category's verbosity lets the line
+// through. A line that passes is stored as a fixed-size binary record: the format string pointer, the raw
+// argument values and a formatter for their types. The record goes into a lock-free multi-producer ring.
+// DeferredLog's drain thread does the formatting and hands each finished line to DAEMON_LOG.
+//
+// Format strings must be string literals; they are not copied. Numbers, bools and enums are stored as they
+// are. Strings are copied into the record and cut to sDeferredLogText's capacity. A full ring drops the line,
+// counted in DeferredLogGetDroppedCount(), rather than block the hot path.
+//
+// Verbosity is checked per category against the level set with DeferredLogSetCategoryVerbosity (Log unless
+// changed), mirroring the defaults App registers with the LogSubsystem. Defining
+// GAME_DEFERRED_LOG_MAX_VERBOSITY (e.g. GAME_DEFERRED_LOG_MAX_VERBOSITY=eLogVerbosity::Warning in a Release
+// configuration) compiles every site above that level out entirely.
+//
+#if !defined(GAME_DEFERRED_LOG_MAX_VERBOSITY)
+#define GAME_DEFERRED_LOG_MAX_VERBOSITY eLogVerbosity::All
+#endif
+
+#define DEFERRED_LOG(category, verbosity, ...)                                                                       \
+    do                                                                                                             \
+    {                                                                                                              \
+        if constexpr (static_cast<int>(verbosity) <= static_cast<int>(GAME_DEFERRED_LOG_MAX_VERBOSITY))            \
+        {                                                                                                          \
+            static int const s_deferredLogCategory = DeferredLogFindCategory(#category);                          \
+            if (DeferredLogIsEnabled(s_deferredLogCategory, verbosity))                                            \
+            {                                                                                                      \
+                DeferredLogPush(+[](String const& message) { DAEMON_LOG(category, verbosity, message); }, __VA_ARGS__); \
+            }                                                                                                      \
+        }                                                                                                          \
+    }                                                                                                              \
+    while (false)
+
+//----------------------------------------------------------------------------------------------------
+using DeferredLogSink      = void (*)(String const& message);     // Calls DAEMON_LOG with the site's category and verbosity
+using DeferredLogFormatter = String (*)(char const* format, std::byte const* payload);
+
+//----------------------------------------------------------------------------------------------------
+struct sDeferredLogText
+{
+    static constexpr size_t CAPACITY = 119;
+
+    char    m_chars[CAPACITY + 1] = {};
+    uint8_t m_length              = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sDeferredLogRecord
+{
+    static constexpr size_t PAYLOAD_BYTES = 256;
+
+    DeferredLogSink      m_sink      = nullptr;
+    DeferredLogFormatter m_formatter = nullptr;
+    char const*          m_format    = nullptr;
+    alignas(std::max_align_t) std::byte m_payload[PAYLOAD_BYTES];
+};
+
+//----------------------------------------------------------------------------------------------------
+// App calls Startup once the LogSubsystem is up and Shutdown before it goes away. Shutdown drains what is left.
+void DeferredLogStartup();
+void DeferredLogShutdown();
+
+int  DeferredLogFindCategory(char const* name);     // Registers the category at Log verbosity on first use
+void DeferredLogSetCategoryVerbosity(char const* name, eLogVerbosity verbosity);
+bool DeferredLogIsEnabled(int category, eLogVerbosity verbosity);
+
+bool DeferredLogPushRecord(sDeferredLogRecord const& record);     // False if the ring was full
+int  DeferredLogGetDroppedCount();
+
+//----------------------------------------------------------------------------------------------------
+namespace DeferredLogDetail
+{
+    //------------------------------------------------------------------------------------------------
+    template <typename T>
+    using Stored = std::conditional_t<std::is_convertible_v<T const&, std::string_view>, sDeferredLogText, std::decay_t<T>>;
+
+    //------------------------------------------------------------------------------------------------
+    template <typename T>
+    Stored<T> Store(T const& value)
+    {
+        if constexpr (std::is_same_v<Stored<T>, sDeferredLogText>)
+        {
+            std::string_view const view = value;
+            sDeferredLogText       text;
+            text.m_length = static_cast<uint8_t>(view.size() < sDeferredLogText::CAPACITY ? view.size() : sDeferredLogText::CAPACITY);
+            std::memcpy(text.m_chars, view.data(), text.m_length);
+            return text;
+        }
+        else
+        {
+            static_assert(std::is_trivially_copyable_v<Stored<T>>, "DEFERRED_LOG arguments must be numbers, enums, bools or strings");
+            return value;
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    template <typename T>
+    decltype(auto) Show(T const& stored)
+    {
+        if constexpr (std::is_same_v<T, sDeferredLogText>)
+        {
+            return std::string_view(stored.m_chars, stored.m_length);
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            return static_cast<std::underlying_type_t<T>>(stored);
+        }
+        else
+        {
+            return (stored);
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Byte offset of each argument in the payload, each aligned for its type; the last entry is the total size
+    template <typename... Values>
+    constexpr std::array<size_t, sizeof...(Values) + 1> GetOffsets()
+    {
+        std::array<size_t, sizeof...(Values) + 1> offsets    = {};
+        size_t                                    offset     = 0;
+        size_t                                    valueIndex = 0;
+        ((offset = (offset + alignof(Values) - 1) / alignof(Values) * alignof(Values), offsets[valueIndex++] = offset, offset += sizeof(Values)), ...);
+        offsets[valueIndex] = offset;
+        return offsets;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    template <typename... Values, size_t... Indices>
+    String Format(char const* format, std::byte const* payload, std::index_sequence<Indices...>)
+    {
+        constexpr auto offsets = GetOffsets<Values...>();
+
+        std::tuple<Values...> values;
+        (std::memcpy(&std::get<Indices>(values), payload + offsets[Indices], sizeof(Values)), ...);
+
+        auto shown = std::tuple{Show(std::get<Indices>(values))...};
+        return std::apply([format](auto&... arguments) { return std::vformat(format, std::make_format_args(arguments...)); }, shown);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    template <typename... Values>
+    String FormatRecord(char const* format, std::byte const* payload)
+    {
+        return Format<Values...>(format, payload, std::index_sequence_for<Values...>());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename... Args>
+void DeferredLogPush(DeferredLogSink sink, char const* format, Args const&... args)
+{
+    using namespace DeferredLogDetail;
+
+    constexpr auto offsets = GetOffsets<Stored<Args>...>();
+    static_assert(offsets.back() <= sDeferredLogRecord::PAYLOAD_BYTES, "DEFERRED_LOG arguments do not fit in a record");
+
+    sDeferredLogRecord record;
+    record.m_sink      = sink;
+    record.m_formatter = &FormatRecord<Stored<Args>...>;
+    record.m_format    = format;
+
+    size_t     valueIndex = 0;
+    auto const write      = [&](auto const& stored) { std::memcpy(record.m_payload + offsets[valueIndex++], &stored, sizeof(stored)); };
+    (write(Store(args)), ...);
+
+    DeferredLogPushRecord(record);
+}
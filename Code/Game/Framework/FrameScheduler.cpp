@@ -0,0 +1,147 @@
+//----------------------------------------------------------------------------------------------------
+// FrameScheduler.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameScheduler.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN		// Always #define this before #including <windows.h>
+#include <windows.h>
+#endif
+
+//----------------------------------------------------------------------------------------------------
+void FrameScheduler::Startup(sFrameSchedulerConfig const& config)
+{
+    m_config             = config;
+    m_hasStarted         = false;
+    m_accumulatedSeconds = 0.0;
+    m_spinThreshold      = std::chrono::duration_cast<SchedulerClock::duration>(std::chrono::duration<double>(m_config.m_spinThresholdSeconds));
+    m_framePeriod        = SchedulerClock::duration::zero();
+
+    if (m_config.m_targetFrameRate > 0.f)
+    {
+        m_framePeriod = std::chrono::duration_cast<SchedulerClock::duration>(std::chrono::duration<double>(1.0 / m_config.m_targetFrameRate));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Leftover time below one step carries into the next frame. Past m_maxStepsPerFrame the backlog is dropped:
+// the simulation runs slow for a frame instead of spending the next frame catching up as well.
+sFrameSteps FrameScheduler::AdvanceSimulation(double const frameDeltaSeconds)
+{
+    sFrameSteps steps;
+    steps.m_frameSeconds = static_cast<float>(frameDeltaSeconds);
+
+    if (!IsFixedTimestep())
+    {
+        return steps;
+    }
+
+    double const stepSeconds = 1.0 / m_config.m_fixedTimestepHz;
+
+    m_accumulatedSeconds += frameDeltaSeconds;
+
+    int stepCount = static_cast<int>(m_accumulatedSeconds / stepSeconds);
+    if (stepCount > m_config.m_maxStepsPerFrame)
+    {
+        stepCount            = m_config.m_maxStepsPerFrame;
+        m_accumulatedSeconds = stepCount * stepSeconds;
+    }
+
+    m_accumulatedSeconds -= stepCount * stepSeconds;
+
+    steps.m_stepCount     = stepCount;
+    steps.m_stepSeconds   = static_cast<float>(stepSeconds);
+    steps.m_interpolation = static_cast<float>(std::clamp(m_accumulatedSeconds / stepSeconds, 0.0, 1.0));
+
+    return steps;
+}
+
+//----------------------------------------------------------------------------------------------------
+void FrameScheduler::WaitForNextFrame()
+{
+    if (m_config.m_isVSyncEnabled || m_framePeriod == SchedulerClock::duration::zero())
+    {
+        return;
+    }
+
+    SchedulerClock::time_point const now = SchedulerClock::now();
+
+    if (!m_hasStarted)
+    {
+        m_hasStarted    = true;
+        m_nextFrameTime = now + m_framePeriod;
+        return;
+    }
+
+    // More than a frame behind: start a new cadence from here rather than running frames back to back
+    if (now > m_nextFrameTime + m_framePeriod)
+    {
+        m_nextFrameTime = now + m_framePeriod;
+        return;
+    }
+
+    WaitUntil(m_nextFrameTime, m_spinThreshold);
+    m_nextFrameTime += m_framePeriod;
+}
+
+//----------------------------------------------------------------------------------------------------
+double FrameScheduler::GetIdleSecondsBeforeNextFrame() const
+{
+    if (m_config.m_isVSyncEnabled || m_framePeriod == SchedulerClock::duration::zero() || !m_hasStarted)
+    {
+        return 0.0;
+    }
+
+    return std::max(std::chrono::duration<double>(m_nextFrameTime - SchedulerClock::now()).count(), 0.0);
+}
+
+//----------------------------------------------------------------------------------------------------
+sFrameSchedulerConfig const& FrameScheduler::GetConfig() const
+{
+    return m_config;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool FrameScheduler::IsFixedTimestep() const
+{
+    return m_config.m_fixedTimestepHz > 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+// On Windows a high-resolution waitable timer sleeps to within a fraction of a millisecond, where a plain
+// Sleep() rounds up to the 15.6 ms system tick; elsewhere sleep_for is already fine-grained
+void FrameScheduler::WaitUntil(SchedulerClock::time_point const deadline, SchedulerClock::duration const spinThreshold)
+{
+    SchedulerClock::duration const sleepDuration = deadline - SchedulerClock::now() - spinThreshold;
+
+    if (sleepDuration > SchedulerClock::duration::zero())
+    {
+#if defined(_WIN32)
+        static HANDLE const s_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+        LARGE_INTEGER dueTime;
+        dueTime.QuadPart = -std::chrono::duration_cast<std::chrono::duration<long long, std::ratio<1, 10000000>>>(sleepDuration).count();   // Relative, in 100 ns units
+
+        if (s_timer != nullptr && SetWaitableTimer(s_timer, &dueTime, 0, nullptr, nullptr, FALSE))
+        {
+            WaitForSingleObject(s_timer, INFINITE);
+        }
+        else
+        {
+            std::this_thread::sleep_for(sleepDuration);
+        }
+#else
+        std::this_thread::sleep_for(sleepDuration);
+#endif
+    }
+
+    while (SchedulerClock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------------------------------
+// FrameScheduler.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <chrono>
+
+//----------------------------------------------------------------------------------------------------
+struct sFrameSchedulerConfig
+{
+    float m_targetFrameRate      = 60.f;      // Frames per second to pace to; 0 runs unpaced
+    bool  m_isVSyncEnabled       = false;     // Present already blocks on the display, so never wait on top of it
+    float m_fixedTimestepHz      = 0.f;       // Simulation steps per second; 0 steps once per frame by the frame delta
+    int   m_maxStepsPerFrame     = 5;         // Caps catch-up after a hitch so a slow frame can't snowball
+    float m_spinThresholdSeconds = 0.002f;    // The last stretch of a wait is spun instead of slept
+};
+
+//----------------------------------------------------------------------------------------------------
+// What the simulation should do this frame
+struct sFrameSteps
+{
+    int   m_stepCount     = 1;       // Simulation steps to run, possibly 0 when the display outruns the timestep
+    float m_stepSeconds   = 0.f;     // Length of each step; 0 means a single variable step of the frame delta
+    float m_interpolation = 1.f;     // Fraction of a step rendering sits past the last completed step, in [0,1)
+    float m_frameSeconds  = 0.f;     // The frame delta these steps were advanced by
+};
+
+//----------------------------------------------------------------------------------------------------
+// Paces App::RunMainLoop to a target frame rate and, optionally, splits elapsed time into fixed simulation steps.
+//
+// WaitForNextFrame() sleeps until the next frame is due. Sleeping alone overshoots by up to the OS timer
+// resolution, so it sleeps until m_spinThresholdSeconds before the deadline and spins the rest. Deadlines
+// advance by whole frame periods from the first frame rather than from whenever the wait returned, so
+// per-frame error does not accumulate into drift. After a long hitch it resynchronizes instead of racing to
+// catch up.
+//
+// With a fixed timestep the simulation advances in equal steps regardless of frame rate, and frame-count
+// timing in script (CubeSpawner's 240-frame interval) counts steps, so it lasts the same wall time at 30 or
+// 144 fps. Rendering interpolates between the last two steps by m_interpolation.
+//
+class FrameScheduler
+{
+public:
+    void Startup(sFrameSchedulerConfig const& config);
+
+    sFrameSteps AdvanceSimulation(double frameDeltaSeconds);
+    void        WaitForNextFrame();
+
+    // Time WaitForNextFrame() would sleep if called now; 0 when unpaced, under vsync or already late
+    double GetIdleSecondsBeforeNextFrame() const;
+
+    sFrameSchedulerConfig const& GetConfig() const;
+    bool                         IsFixedTimestep() const;
+
+private:
+    using SchedulerClock = std::chrono::steady_clock;
+
+    static void WaitUntil(SchedulerClock::time_point deadline, SchedulerClock::duration spinThreshold);
+
+    sFrameSchedulerConfig      m_config;
+    SchedulerClock::duration   m_framePeriod{0};
+    SchedulerClock::duration   m_spinThreshold{0};
+    SchedulerClock::time_point m_nextFrameTime;
+    bool                       m_hasStarted         = false;
+    double                     m_accumulatedSeconds = 0.0;     // Frame time not yet consumed by a fixed step
+};
@@ -9,6 +9,7 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/Renderer.hpp"
 #include "Engine/Renderer/Vertex_PCU.hpp"
+#include "Game/Framework/GeometryTables.hpp"
 
 //-----------------------------------------------------------------------------------------------
 // DebugRender color-related
@@ -32,17 +33,15 @@ void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 cons
     constexpr int NUM_VERTS     = 3 * NUM_TRIS;
     Vertex_PCU    verts[NUM_VERTS];
 
-    constexpr float DEGREES_PER_SIDE = 360.f / static_cast<float>(NUM_SIDES);
+    sUnitCircleTable<NUM_SIDES> const& unitCircle = UNIT_CIRCLE_TABLE<NUM_SIDES>;
 
     for (int sideNum = 0; sideNum < NUM_SIDES; ++sideNum)
     {
-        // Compute angle-related terms
-        float startDegrees = DEGREES_PER_SIDE * static_cast<float>(sideNum);
-        float endDegrees   = DEGREES_PER_SIDE * static_cast<float>(sideNum + 1);
-        float cosStart     = CosDegrees(startDegrees);
-        float sinStart     = SinDegrees(startDegrees);
-        float cosEnd       = CosDegrees(endDegrees);
-        float sinEnd       = SinDegrees(endDegrees);
+        // Angle-related terms come from the compile-time table
+        float cosStart = unitCircle.m_cos[sideNum];
+        float sinStart = unitCircle.m_sin[sideNum];
+        float cosEnd   = unitCircle.m_cos[sideNum + 1];
+        float sinEnd   = unitCircle.m_sin[sideNum + 1];
 
         // Compute inner & outer positions
         Vec3 innerStartPos(center.x + innerRadius * cosStart, center.y + innerRadius * sinStart, 0.f);
@@ -120,17 +119,15 @@ void DebugDrawGlowCircle(Vec2 const& center, float radius, Rgba8 const& color, f
     constexpr int NUM_VERTS = 3 * NUM_TRIS; // Each triangle has 3 vertices
     Vertex_PCU    verts[NUM_VERTS];
 
-    constexpr float DEGREES_PER_SIDE = 360.f / static_cast<float>(NUM_SIDES);
+    sUnitCircleTable<NUM_SIDES> const& unitCircle = UNIT_CIRCLE_TABLE<NUM_SIDES>;
 
     for (int sideNum = 0; sideNum < NUM_SIDES; ++sideNum)
     {
-        // Calculate the start and end angles
-        float startDegrees = DEGREES_PER_SIDE * static_cast<float>(sideNum);
-        float endDegrees   = DEGREES_PER_SIDE * static_cast<float>(sideNum + 1);
-        float cosStart     = CosDegrees(startDegrees);
-        float sinStart     = SinDegrees(startDegrees);
-        float cosEnd       = CosDegrees(endDegrees);
-        float sinEnd       = SinDegrees(endDegrees);
+        // Start and end directions come from the compile-time table
+        float cosStart = unitCircle.m_cos[sideNum];
+        float sinStart = unitCircle.m_sin[sideNum];
+        float cosEnd   = unitCircle.m_cos[sideNum + 1];
+        float sinEnd   = unitCircle.m_sin[sideNum + 1];
 
         // Calculate the positions of the center and the edge vertices of the circle
         Vec3 centerPos(center.x, center.y, 0.f);                                        // Center of the circle
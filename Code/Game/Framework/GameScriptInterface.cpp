@@ -7,10 +7,18 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Gameplay/Game.hpp"
 #include "Game/Gameplay/Player.hpp"
+#include "Game/Gameplay/PropIntegrator.hpp"
+#include "Game/Framework/AllocationTracker.hpp"
 #include "Game/Framework/App.hpp"
+#include "Game/Framework/BenchmarkSupport.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/Profiler.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/Time.hpp"
+
+#include <chrono>
 
 //----------------------------------------------------------------------------------------------------
 GameScriptInterface::GameScriptInterface(Game* game)
@@ -20,36 +28,95 @@ GameScriptInterface::GameScriptInterface(Game* game)
     {
         ERROR_AND_DIE("GameScriptInterface: Game pointer cannot be null")
     }
+
+    // Every binding is registered exactly once; CallMethod then resolves a name with a single hash lookup
+    // instead of walking a chain of string compares that grows with every new binding.
+    RegisterMethodHandler("appRequestQuit", &GameScriptInterface::ExecuteAppRequestQuit);
+    RegisterMethodHandler("createCube", &GameScriptInterface::ExecuteCreateCube);
+    RegisterMethodHandler("destroyProp", &GameScriptInterface::ExecuteDestroyProp);
+    RegisterMethodHandler("setPropTexture", &GameScriptInterface::ExecuteSetPropTexture);
+    RegisterMethodHandler("moveProp", &GameScriptInterface::ExecuteMoveProp);
+    RegisterMethodHandler("movePlayerCamera", &GameScriptInterface::ExecuteMovePlayerCamera);
+    RegisterMethodHandler("update", &GameScriptInterface::ExecuteUpdate);
+    RegisterMethodHandler("render", &GameScriptInterface::ExecuteRender);
+    RegisterMethodHandler("executeCommand", &GameScriptInterface::ExecuteJavaScriptCommand);
+    RegisterMethodHandler("executeFile", &GameScriptInterface::ExecuteJavaScriptFile);
+    RegisterMethodHandler("isAttractMode", &GameScriptInterface::ExecuteIsAttractMode);
+    RegisterMethodHandler("benchmarkDispatch", &GameScriptInterface::ExecuteBenchmarkDispatch);
+    RegisterMethodHandler("submitCommands", &GameScriptInterface::ExecuteSubmitCommands);
+    RegisterMethodHandler("benchmarkPropIntegrator", &GameScriptInterface::ExecuteBenchmarkPropIntegrator);
+    RegisterMethodHandler("queryPropsInRadius", &GameScriptInterface::ExecuteQueryPropsInRadius);
+    RegisterMethodHandler("getQueriedProp", &GameScriptInterface::ExecuteGetQueriedProp);
+    RegisterMethodHandler("nowMilliseconds", &GameScriptInterface::ExecuteNowMilliseconds);
+    RegisterMethodHandler("writeBenchmarkReport", &GameScriptInterface::ExecuteWriteBenchmarkReport);
+    RegisterMethodHandler("touchScriptFile", &GameScriptInterface::ExecuteTouchScriptFile);
+    RegisterMethodHandler("setAllocationBudgetArmed", &GameScriptInterface::ExecuteSetAllocationBudgetArmed);
+
+    // Left out entirely when the profiler is compiled out, so Profiler.js sees no binding and never calls across
+#if !defined(GAME_DISABLE_PROFILER)
+    RegisterMethodHandler("profileBegin", &GameScriptInterface::ExecuteProfileBegin);
+    RegisterMethodHandler("profileEnd", &GameScriptInterface::ExecuteProfileEnd);
+    RegisterMethodHandler("profileStartCapture", &GameScriptInterface::ExecuteProfileStartCapture);
+    RegisterMethodHandler("profileStopCapture", &GameScriptInterface::ExecuteProfileStopCapture);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+void GameScriptInterface::RegisterMethodHandler(String const& methodName, MethodHandler const handler)
+{
+    if (m_methodIDsByName.contains(methodName))
+    {
+        ERROR_AND_DIE(StringFormat("(GameScriptInterface::RegisterMethodHandler)(method {} registered twice)", methodName))
+    }
+
+    int const methodID = static_cast<int>(m_methodHandlers.size());
+
+    m_methodHandlers.push_back(handler);
+    m_methodNames.push_back(methodName);
+    m_methodIDsByName.emplace(methodName, methodID);
+}
+
+//----------------------------------------------------------------------------------------------------
+int GameScriptInterface::GetMethodID(String const& methodName) const
+{
+    auto const found = m_methodIDsByName.find(methodName);
+
+    return found != m_methodIDsByName.end() ? found->second : -1;
 }
 
 //----------------------------------------------------------------------------------------------------
 std::vector<ScriptMethodInfo> GameScriptInterface::GetAvailableMethods() const
 {
-    return {
+    std::vector<ScriptMethodInfo> methods = {
         ScriptMethodInfo("appRequestQuit",
                          "Request quit to app",
                          {},
                          "void"),
 
         ScriptMethodInfo("createCube",
-                         "在指定位置創建一個立方體",
+                         "在指定位置創建一個立方體，回傳道具索引（失敗時為 -1）",
                          {"float", "float", "float"},
-                         "string"),
+                         "int"),
+
+        ScriptMethodInfo("destroyProp",
+                         "銷毀指定索引的道具，回收其位置（已失效的索引回傳 false）",
+                         {"int"},
+                         "bool"),
+
+        ScriptMethodInfo("setPropTexture",
+                         "以非同步方式載入貼圖並套用到道具（載入完成前顯示無貼圖，已失效的索引回傳 false）",
+                         {"int", "string"},
+                         "bool"),
 
         ScriptMethodInfo("moveProp",
                          "移動指定索引的道具到新位置",
                          {"int", "float", "float", "float"},
-                         "string"),
-
-        ScriptMethodInfo("getPlayerPosition",
-                         "取得玩家目前位置",
-                         {},
-                         "object"),
+                         "void"),
 
         ScriptMethodInfo("movePlayerCamera",
                          "移動玩家相機（用於晃動效果）",
                          {"float", "float", "float"},
-                         "string"),
+                         "void"),
 
         ScriptMethodInfo("update",
                          "JavaScript GameLoop Update",
@@ -79,8 +146,79 @@ std::vector<ScriptMethodInfo> GameScriptInterface::GetAvailableMethods() const
         ScriptMethodInfo("getFileTimestamp",
                          "取得檔案的最後修改時間戳記",
                          {"string"},
-                         "number")
+                         "number"),
+
+        ScriptMethodInfo("submitCommands",
+                         "一次提交多個打包的道具指令（移動、顏色、角速度、生成、銷毀）",
+                         {"...float"},
+                         "void"),
+
+        ScriptMethodInfo("benchmarkDispatch",
+                         "比較字串比對與雜湊表的方法分派成本",
+                         {"int"},
+                         "string"),
+
+        ScriptMethodInfo("benchmarkPropIntegrator",
+                         "以 1k / 10k / 100k 道具測試純量與 SIMD 積分器及矩陣建構",
+                         {},
+                         "string"),
+
+        ScriptMethodInfo("queryPropsInRadius",
+                         "查詢球形範圍內的道具，回傳數量（以 getQueriedProp 逐一讀取）",
+                         {"float", "float", "float", "float"},
+                         "int"),
+
+        ScriptMethodInfo("getQueriedProp",
+                         "取得上一次 queryPropsInRadius 結果中的道具索引",
+                         {"int"},
+                         "int"),
+
+        ScriptMethodInfo("nowMilliseconds",
+                         "取得高解析度時鐘的目前時間（毫秒），供 JS 測量系統耗時",
+                         {},
+                         "double"),
+
+        ScriptMethodInfo("writeBenchmarkReport",
+                         "將基準測試報告（JSON 字串）寫入 -benchmarkReport 指定的路徑",
+                         {"string"},
+                         "bool"),
+
+        ScriptMethodInfo("touchScriptFile",
+                         "更新腳本檔案的修改時間以觸發熱重載（內容不變）",
+                         {"string"},
+                         "bool"),
+
+        ScriptMethodInfo("setAllocationBudgetArmed",
+                         "啟用或停用每幀記憶體配置預算檢查（載入與生成期間應停用）",
+                         {"bool"},
+                         "void")
     };
+
+#if !defined(GAME_DISABLE_PROFILER)
+    methods.insert(methods.end(), {
+        ScriptMethodInfo("profileBegin",
+                         "開始一個效能分析區段（與 profileEnd 成對，可巢狀）",
+                         {"string"},
+                         "void"),
+
+        ScriptMethodInfo("profileEnd",
+                         "結束最近開始的效能分析區段",
+                         {},
+                         "void"),
+
+        ScriptMethodInfo("profileStartCapture",
+                         "開始記錄所有效能分析區段",
+                         {},
+                         "void"),
+
+        ScriptMethodInfo("profileStopCapture",
+                         "停止記錄並輸出 Chrome trace JSON，回傳區段數量（失敗時為 -1）",
+                         {"string"},
+                         "int")
+    });
+#endif
+
+    return methods;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -88,7 +226,29 @@ std::vector<String> GameScriptInterface::GetAvailableProperties() const
 {
     return {
         "attractMode",
-        "gameState"
+        "gameState",
+        "gameDeltaSeconds",
+        "systemDeltaSeconds",
+        "frameStepCount",
+        "playerPositionX",
+        "playerPositionY",
+        "playerPositionZ",
+        "propCount",
+        "livePropCount",
+        "benchmarkMode",
+        "devToolsEnabled",
+        "scriptRuntimeProfile",
+        "replayMode",
+        "randomSeed",
+        "processPrivateBytes",
+        "scriptStartupMs",
+        "idleGcCount",
+        "idleGcLastPauseMs",
+        "idleGcMaxPauseMs",
+        "idleGcSkippedCount",
+        "frameAllocationCount",
+        "frameAllocatedBytes",
+        "allocationOverBudgetFrames"
     };
 }
 
@@ -96,51 +256,28 @@ std::vector<String> GameScriptInterface::GetAvailableProperties() const
 ScriptMethodResult GameScriptInterface::CallMethod(String const&     methodName,
                                                    ScriptArgs const& args)
 {
-    try
-    {
-        if (methodName == "appRequestQuit")
-        {
-            return ExecuteAppRequestQuit(args);
-        }
-        else if (methodName == "createCube")
-        {
-            return ExecuteCreateCube(args);
-        }
-        else if (methodName == "moveProp")
-        {
-            return ExecuteMoveProp(args);
-        }
-        else if (methodName == "getPlayerPosition")
-        {
-            return ExecuteGetPlayerPosition(args);
-        }
-        else if (methodName == "movePlayerCamera")
-        {
-            return ExecuteMovePlayerCamera(args);
-        }
-        else if (methodName == "update")
-        {
-            return ExecuteUpdate(args);
-        }
-        else if (methodName == "render")
-        {
-            return ExecuteRender(args);
-        }
-        else if (methodName == "executeCommand")
-        {
-            return ExecuteJavaScriptCommand(args);
-        }
-        else if (methodName == "executeFile")
-        {
-            return ExecuteJavaScriptFile(args);
-        }
-        else if (methodName == "isAttractMode")
-        {
-            return ExecuteIsAttractMode(args);
-        }
+    int const methodID = GetMethodID(methodName);
 
+    if (methodID < 0)
+    {
         return ScriptMethodResult::Error("未知的方法: " + methodName);
     }
+
+    return CallMethodByID(methodID, args);
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::CallMethodByID(int const methodID, ScriptArgs const& args)
+{
+    if (methodID < 0 || methodID >= static_cast<int>(m_methodHandlers.size()))
+    {
+        return ScriptMethodResult::Error(StringFormat("未知的方法 ID: {}", methodID));
+    }
+
+    try
+    {
+        return (this->*m_methodHandlers[methodID])(args);
+    }
     catch (std::exception const& e)
     {
         return ScriptMethodResult::Error("方法執行時發生例外: " + String(e.what()));
@@ -170,6 +307,102 @@ std::any GameScriptInterface::GetProperty(const String& propertyName) const
             return String("UNKNOWN");
         }
     }
+    else if (propertyName == "gameDeltaSeconds")
+    {
+        // Read by the per-frame JSEngine.update() entry point (see Game::UpdateJS)
+        return m_game->GetJSGameDeltaSeconds();
+    }
+    else if (propertyName == "systemDeltaSeconds")
+    {
+        return m_game->GetJSSystemDeltaSeconds();
+    }
+    else if (propertyName == "frameStepCount")
+    {
+        return m_game->GetFrameStepCount();
+    }
+    else if (propertyName == "playerPositionX" || propertyName == "playerPositionY" || propertyName == "playerPositionZ")
+    {
+        // One number per axis so polling the player position never builds a string or a temporary object
+        Player const* player = m_game->GetPlayer();
+        if (!player)
+        {
+            return 0.f;
+        }
+
+        char const axis = propertyName.back();
+
+        if (axis == 'X') return player->m_position.x;
+        if (axis == 'Y') return player->m_position.y;
+        return player->m_position.z;
+    }
+    else if (propertyName == "propCount")
+    {
+        return m_game->GetPropCount();
+    }
+    else if (propertyName == "livePropCount")
+    {
+        return m_game->GetLivePropCount();
+    }
+    else if (propertyName == "benchmarkMode")
+    {
+        return g_app->GetBenchmarkOptions().m_isEnabled;
+    }
+    else if (propertyName == "devToolsEnabled")
+    {
+        return g_app->GetBenchmarkOptions().m_isDevToolsEnabled;
+    }
+    else if (propertyName == "scriptRuntimeProfile")
+    {
+        return String(GetScriptRuntimeProfileName(g_app->GetScriptRuntimeProfile()));
+    }
+    else if (propertyName == "replayMode")
+    {
+        return String(GetReplayModeName(g_app->GetReplaySession().GetMode()));
+    }
+    else if (propertyName == "randomSeed")
+    {
+        // A double so the full uint32 range survives; seeds core/SeededRandom.js
+        return static_cast<double>(g_app->GetReplaySession().GetSeed());
+    }
+    else if (propertyName == "processPrivateBytes")
+    {
+        // A double: exact far past 4 GB, unlike an int
+        return static_cast<double>(GetProcessPrivateBytes());
+    }
+    else if (propertyName == "scriptStartupMs")
+    {
+        return static_cast<double>(m_game->GetScriptStartupMs());
+    }
+    else if (propertyName == "idleGcCount")
+    {
+        // Collections run between frames by App's IdleGarbageCollector (see IdleGarbageCollector.hpp)
+        return g_app->GetIdleGarbageCollectorStats().m_collectionCount;
+    }
+    else if (propertyName == "idleGcLastPauseMs")
+    {
+        return static_cast<double>(g_app->GetIdleGarbageCollectorStats().m_lastPauseMs);
+    }
+    else if (propertyName == "idleGcMaxPauseMs")
+    {
+        return static_cast<double>(g_app->GetIdleGarbageCollectorStats().m_maxPauseMs);
+    }
+    else if (propertyName == "idleGcSkippedCount")
+    {
+        return g_app->GetIdleGarbageCollectorStats().m_skippedCount;
+    }
+    else if (propertyName == "frameAllocationCount")
+    {
+        // Heap allocations in the last completed frame (see AllocationTracker.hpp)
+        return static_cast<double>(AllocationTrackerGetLastFrame().m_allocationCount);
+    }
+    else if (propertyName == "frameAllocatedBytes")
+    {
+        return static_cast<double>(AllocationTrackerGetLastFrame().m_allocatedBytes);
+    }
+    else if (propertyName == "allocationOverBudgetFrames")
+    {
+        return AllocationTrackerGetOverBudgetFrameCount();
+    }
 
     return std::any{};
 }
@@ -237,11 +470,9 @@ ScriptMethodResult GameScriptInterface::ExecuteCreateCube(const ScriptArgs& args
     try
     {
         Vec3 position = ScriptTypeExtractor::ExtractVec3(args, 0);
-        m_game->CreateCube(position);
-        return ScriptMethodResult::Success(String("立方體創建成功，位置: (" +
-            std::to_string(position.x) + ", " +
-            std::to_string(position.y) + ", " +
-            std::to_string(position.z) + ")"));
+        PropHandle const handle = m_game->CreateCube(position);
+        g_app->GetReplaySession().RecordCall(eReplayCall::CREATE_CUBE, {position.x, position.y, position.z, handle});
+        return ScriptMethodResult::Success(handle);
     }
     catch (const std::exception& e)
     {
@@ -250,55 +481,58 @@ ScriptMethodResult GameScriptInterface::ExecuteCreateCube(const ScriptArgs& args
 }
 
 //----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ExecuteMoveProp(const ScriptArgs& args)
+ScriptMethodResult GameScriptInterface::ExecuteDestroyProp(ScriptArgs const& args)
 {
-    auto result = ScriptTypeExtractor::ValidateArgCount(args, 4, "moveProp");
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 1, "destroyProp");
     if (!result.success) return result;
 
     try
     {
-        int  propIndex   = ScriptTypeExtractor::ExtractInt(args[0]);
-        Vec3 newPosition = ScriptTypeExtractor::ExtractVec3(args, 1);
-        m_game->MoveProp(propIndex, newPosition);
-        return ScriptMethodResult::Success(String("道具 " + std::to_string(propIndex) +
-            " 移動成功，新位置: (" +
-            std::to_string(newPosition.x) + ", " +
-            std::to_string(newPosition.y) + ", " +
-            std::to_string(newPosition.z) + ")"));
+        PropHandle const handle = ScriptTypeExtractor::ExtractInt(args[0]);
+        g_app->GetReplaySession().RecordCall(eReplayCall::DESTROY_PROP, {handle});
+        return ScriptMethodResult::Success(m_game->DestroyProp(handle));
     }
-    catch (const std::exception& e)
+    catch (std::exception const& e)
     {
-        return ScriptMethodResult::Error("移動道具失敗: " + String(e.what()));
+        return ScriptMethodResult::Error("銷毀道具失敗: " + String(e.what()));
     }
 }
 
 //----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ExecuteGetPlayerPosition(const ScriptArgs& args)
+ScriptMethodResult GameScriptInterface::ExecuteSetPropTexture(ScriptArgs const& args)
 {
-    auto result = ScriptTypeExtractor::ValidateArgCount(args, 0, "getPlayerPosition");
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 2, "setPropTexture");
     if (!result.success) return result;
 
     try
     {
-        Player* player = m_game->GetPlayer();
-        if (!player)
-        {
-            return ScriptMethodResult::Error("玩家物件不存在");
-        }
-
-        Vec3 position = player->m_position;
-
+        PropHandle const handle = ScriptTypeExtractor::ExtractInt(args[0]);
+        String const     path   = ScriptTypeExtractor::ExtractString(args[1]);
+        return ScriptMethodResult::Success(m_game->RequestPropTexture(handle, path));
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("設定道具貼圖失敗: " + String(e.what()));
+    }
+}
 
-        // 回傳一個可以被 JavaScript 使用的物件
-        String positionStr = "{ x: " + std::to_string(position.x) +
-            ", y: " + std::to_string(position.y) +
-            ", z: " + std::to_string(position.z) + " }";
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteMoveProp(const ScriptArgs& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 4, "moveProp");
+    if (!result.success) return result;
 
-        return ScriptMethodResult::Success(positionStr);
+    try
+    {
+        int  propIndex   = ScriptTypeExtractor::ExtractInt(args[0]);
+        Vec3 newPosition = ScriptTypeExtractor::ExtractVec3(args, 1);
+        g_app->GetReplaySession().RecordCall(eReplayCall::MOVE_PROP, {propIndex, newPosition.x, newPosition.y, newPosition.z});
+        m_game->MoveProp(propIndex, newPosition);
+        return ScriptMethodResult::Success();
     }
     catch (const std::exception& e)
     {
-        return ScriptMethodResult::Error("取得玩家位置失敗: " + String(e.what()));
+        return ScriptMethodResult::Error("移動道具失敗: " + String(e.what()));
     }
 }
 
@@ -311,11 +545,9 @@ ScriptMethodResult GameScriptInterface::ExecuteMovePlayerCamera(const ScriptArgs
     try
     {
         Vec3 offset = ScriptTypeExtractor::ExtractVec3(args, 0);
+        g_app->GetReplaySession().RecordCall(eReplayCall::MOVE_PLAYER_CAMERA, {offset.x, offset.y, offset.z});
         m_game->MovePlayerCamera(offset);
-        return ScriptMethodResult::Success(String("相機位置已移動: (" +
-            std::to_string(offset.x) + ", " +
-            std::to_string(offset.y) + ", " +
-            std::to_string(offset.z) + ")"));
+        return ScriptMethodResult::Success();
     }
     catch (const std::exception& e)
     {
@@ -331,7 +563,7 @@ ScriptMethodResult GameScriptInterface::ExecuteRender(const ScriptArgs& args)
     try
     {
         m_game->Render();
-        return ScriptMethodResult::Success(Stringf("Render Success"));
+        return ScriptMethodResult::Success();
     }
     catch (const std::exception& e)
     {
@@ -350,7 +582,7 @@ ScriptMethodResult GameScriptInterface::ExecuteUpdate(const ScriptArgs& args)
         float systemDeltaSeconds = ScriptTypeExtractor::ExtractFloat(args[1]);
 
         m_game->Update(gameDeltaSeconds, systemDeltaSeconds);
-        return ScriptMethodResult::Success(Stringf("Update Success"));
+        return ScriptMethodResult::Success();
     }
     catch (std::exception const& e)
     {
@@ -410,3 +642,285 @@ ScriptMethodResult GameScriptInterface::ExecuteIsAttractMode(const ScriptArgs& a
         return ScriptMethodResult::Error("檢查吸引模式失敗: " + String(e.what()));
     }
 }
+
+//----------------------------------------------------------------------------------------------------
+// game.submitCommands(...packedCommands): one crossing for a whole frame of prop mutations.
+// JavaScript spreads its Float32Array command buffer into the call; the values are only unpacked and queued
+// here, while decoding and applying happens in Game::Update (see PropCommand.hpp for the layout).
+//
+ScriptMethodResult GameScriptInterface::ExecuteSubmitCommands(ScriptArgs const& args)
+{
+    if (args.empty())
+    {
+        return ScriptMethodResult::Success();
+    }
+
+    try
+    {
+        m_commandScratch.clear();
+        m_commandScratch.reserve(args.size());
+
+        for (std::any const& arg : args)
+        {
+            m_commandScratch.push_back(ScriptTypeExtractor::ExtractFloat(arg));
+        }
+
+        g_app->GetReplaySession().RecordCommandBuffer(m_commandScratch.data(), static_cast<int>(m_commandScratch.size()));
+        m_game->SubmitPropCommands(m_commandScratch.data(), static_cast<int>(m_commandScratch.size()));
+        return ScriptMethodResult::Success();
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("submitCommands 失敗: " + String(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Microbenchmark for CallMethod dispatch, run from the DevTools console: game.benchmarkDispatch(1000000)
+// Compares, per call, the old if/else chain of string compares against the hashed name lookup and the
+// cached-ID table index. Only the method resolution is timed; no binding is actually executed.
+//
+ScriptMethodResult GameScriptInterface::ExecuteBenchmarkDispatch(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 1, "benchmarkDispatch");
+    if (!result.success) return result;
+
+    try
+    {
+        int const iterations = ScriptTypeExtractor::ExtractInt(args[0]);
+        if (iterations <= 0)
+        {
+            return ScriptMethodResult::Error("benchmarkDispatch: iterations must be positive");
+        }
+
+        using BenchmarkClock = std::chrono::steady_clock;
+
+        int const   methodCount = static_cast<int>(m_methodNames.size());
+        std::size_t checksum    = 0;
+
+        // Old dispatch: compare against each name in registration order until one matches
+        BenchmarkClock::time_point const linearStart = BenchmarkClock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            String const& methodName = m_methodNames[i % methodCount];
+            for (int methodID = 0; methodID < methodCount; ++methodID)
+            {
+                if (methodName == m_methodNames[methodID])
+                {
+                    checksum += static_cast<std::size_t>(methodID);
+                    break;
+                }
+            }
+        }
+        BenchmarkClock::time_point const linearEnd = BenchmarkClock::now();
+
+        // New dispatch by name: one hash lookup
+        for (int i = 0; i < iterations; ++i)
+        {
+            checksum += static_cast<std::size_t>(GetMethodID(m_methodNames[i % methodCount]));
+        }
+        BenchmarkClock::time_point const hashedEnd = BenchmarkClock::now();
+
+        // New dispatch by cached ID: one bounds-checked table index
+        for (int i = 0; i < iterations; ++i)
+        {
+            checksum += m_methodHandlers[i % methodCount] != nullptr ? 1u : 0u;
+        }
+        BenchmarkClock::time_point const indexedEnd = BenchmarkClock::now();
+
+        auto const nanosecondsPerCall = [iterations](BenchmarkClock::duration const elapsed)
+        {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / static_cast<double>(iterations);
+        };
+
+        String const report = StringFormat("(GameScriptInterface::benchmarkDispatch)({} calls, {} methods)(string compare chain: {:.2f} ns/call)(hashed name: {:.2f} ns/call)(cached ID: {:.2f} ns/call)(checksum: {})",
+                                           iterations,
+                                           methodCount,
+                                           nanosecondsPerCall(linearEnd - linearStart),
+                                           nanosecondsPerCall(hashedEnd - linearEnd),
+                                           nanosecondsPerCall(indexedEnd - hashedEnd),
+                                           checksum);
+
+        DAEMON_LOG(LogScript, eLogVerbosity::Display, report);
+        return ScriptMethodResult::Success(report);
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("benchmarkDispatch 失敗: " + String(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// game.benchmarkPropIntegrator(): runs on scratch arrays, the live prop pool is untouched
+ScriptMethodResult GameScriptInterface::ExecuteBenchmarkPropIntegrator(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 0, "benchmarkPropIntegrator");
+    if (!result.success) return result;
+
+    String const report = RunPropIntegratorBenchmark();
+
+    DAEMON_LOG(LogScript, eLogVerbosity::Display, report);
+    return ScriptMethodResult::Success(report);
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteQueryPropsInRadius(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 4, "queryPropsInRadius");
+    if (!result.success) return result;
+
+    try
+    {
+        Vec3 const  center = ScriptTypeExtractor::ExtractVec3(args, 0);
+        float const radius = ScriptTypeExtractor::ExtractFloat(args[3]);
+        return ScriptMethodResult::Success(m_game->QueryPropsInRadius(center, radius));
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("查詢範圍內道具失敗: " + String(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteGetQueriedProp(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 1, "getQueriedProp");
+    if (!result.success) return result;
+
+    try
+    {
+        int const resultIndex = ScriptTypeExtractor::ExtractInt(args[0]);
+        return ScriptMethodResult::Success(m_game->GetQueriedProp(resultIndex));
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("取得查詢結果失敗: " + String(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// game.nowMilliseconds(): a double, so sub-microsecond differences survive however long the app has run
+ScriptMethodResult GameScriptInterface::ExecuteNowMilliseconds(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 0, "nowMilliseconds");
+    if (!result.success) return result;
+
+    return ScriptMethodResult::Success(GetCurrentTimeSeconds() * 1000.0);
+}
+
+//----------------------------------------------------------------------------------------------------
+// game.writeBenchmarkReport(json): the path comes from the command line, so script cannot write elsewhere
+ScriptMethodResult GameScriptInterface::ExecuteWriteBenchmarkReport(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 1, "writeBenchmarkReport");
+    if (!result.success) return result;
+
+    try
+    {
+        String const  report     = ScriptTypeExtractor::ExtractString(args[0]);
+        String const& reportPath = g_app->GetBenchmarkOptions().m_reportPath;
+        bool const    isWritten  = WriteBenchmarkTextFile(reportPath, report);
+
+        DAEMON_LOG(LogScript, isWritten ? eLogVerbosity::Display : eLogVerbosity::Error, StringFormat("(GameScriptInterface::ExecuteWriteBenchmarkReport)(path: {}, written: {})", reportPath, isWritten));
+        return ScriptMethodResult::Success(isWritten);
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("寫入基準測試報告失敗: " + String(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteSetAllocationBudgetArmed(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 1, "setAllocationBudgetArmed");
+    if (!result.success) return result;
+
+    try
+    {
+        AllocationTrackerSetBudgetArmed(ScriptTypeExtractor::ExtractBool(args[0]));
+        return ScriptMethodResult::Success();
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("設定記憶體配置預算失敗: " + String(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteTouchScriptFile(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 1, "touchScriptFile");
+    if (!result.success) return result;
+
+    try
+    {
+        return ScriptMethodResult::Success(TouchBenchmarkFile(ScriptTypeExtractor::ExtractString(args[0])));
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("更新腳本檔案時間失敗: " + String(e.what()));
+    }
+}
+
+#if !defined(GAME_DISABLE_PROFILER)
+
+//----------------------------------------------------------------------------------------------------
+// game.profileBegin(name) / game.profileEnd(): called through Profiler.js, once per zone edge, so kept minimal
+ScriptMethodResult GameScriptInterface::ExecuteProfileBegin(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 1, "profileBegin");
+    if (!result.success) return result;
+
+    try
+    {
+        ProfilerBeginScriptZone(ScriptTypeExtractor::ExtractString(args[0]));
+        return ScriptMethodResult::Success();
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("開始效能分析區段失敗: " + String(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteProfileEnd(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 0, "profileEnd");
+    if (!result.success) return result;
+
+    ProfilerEndScriptZone();
+    return ScriptMethodResult::Success();
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteProfileStartCapture(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 0, "profileStartCapture");
+    if (!result.success) return result;
+
+    ProfilerStartCapture();
+    return ScriptMethodResult::Success();
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteProfileStopCapture(ScriptArgs const& args)
+{
+    auto result = ScriptTypeExtractor::ValidateArgCount(args, 1, "profileStopCapture");
+    if (!result.success) return result;
+
+    try
+    {
+        String const path      = ScriptTypeExtractor::ExtractString(args[0]);
+        int const    zoneCount = ProfilerStopCapture(path);
+
+        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(GameScriptInterface::ExecuteProfileStopCapture)(path: {}, zones: {})", path, zoneCount));
+        return ScriptMethodResult::Success(zoneCount);
+    }
+    catch (std::exception const& e)
+    {
+        return ScriptMethodResult::Error("輸出效能分析記錄失敗: " + String(e.what()));
+    }
+}
+
+#endif
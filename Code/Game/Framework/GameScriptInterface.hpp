@@ -5,6 +5,8 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 //----------------------------------------------------------------------------------------------------
+#include <unordered_map>
+
 #include "Engine/Script/IScriptableObject.hpp"
 #include "Engine/Script/ScriptTypeExtractor.hpp"
 
@@ -24,17 +26,46 @@ public:
     std::any           GetProperty(String const& propertyName) const override;
     bool               SetProperty(String const& propertyName, std::any const& value) override;
 
+    // Method IDs are resolved once per name; callers that cache the ID skip the name lookup entirely
+    int                GetMethodID(String const& methodName) const;
+    ScriptMethodResult CallMethodByID(int methodID, ScriptArgs const& args);
+
 private:
-    Game* m_game;
+    using MethodHandler = ScriptMethodResult (GameScriptInterface::*)(ScriptArgs const& args);
+
+    void RegisterMethodHandler(String const& methodName, MethodHandler handler);
+
+    Game*                           m_game;
+    std::vector<MethodHandler>      m_methodHandlers;     // Indexed by method ID
+    std::vector<String>             m_methodNames;        // Indexed by method ID, in registration order
+    std::unordered_map<String, int> m_methodIDsByName;
+    std::vector<float>              m_commandScratch;     // Reused by submitCommands to unpack its arguments
 
     ScriptMethodResult ExecuteAppRequestQuit(ScriptArgs const& args);
     ScriptMethodResult ExecuteCreateCube(ScriptArgs const& args);
+    ScriptMethodResult ExecuteDestroyProp(ScriptArgs const& args);
+    ScriptMethodResult ExecuteSetPropTexture(ScriptArgs const& args);
     ScriptMethodResult ExecuteMoveProp(ScriptArgs const& args);
-    ScriptMethodResult ExecuteGetPlayerPosition(ScriptArgs const& args);
     ScriptMethodResult ExecuteMovePlayerCamera(ScriptArgs const& args);
     ScriptMethodResult ExecuteRender(ScriptArgs const& args);
     ScriptMethodResult ExecuteUpdate(ScriptArgs const& args);
     ScriptMethodResult ExecuteJavaScriptCommand(ScriptArgs const& args);
     ScriptMethodResult ExecuteJavaScriptFile(ScriptArgs const& args);
     ScriptMethodResult ExecuteIsAttractMode(ScriptArgs const& args);
+    ScriptMethodResult ExecuteBenchmarkDispatch(ScriptArgs const& args);
+    ScriptMethodResult ExecuteSubmitCommands(ScriptArgs const& args);
+    ScriptMethodResult ExecuteBenchmarkPropIntegrator(ScriptArgs const& args);
+    ScriptMethodResult ExecuteQueryPropsInRadius(ScriptArgs const& args);
+    ScriptMethodResult ExecuteGetQueriedProp(ScriptArgs const& args);
+    ScriptMethodResult ExecuteNowMilliseconds(ScriptArgs const& args);
+    ScriptMethodResult ExecuteWriteBenchmarkReport(ScriptArgs const& args);
+    ScriptMethodResult ExecuteTouchScriptFile(ScriptArgs const& args);
+    ScriptMethodResult ExecuteSetAllocationBudgetArmed(ScriptArgs const& args);
+
+#if !defined(GAME_DISABLE_PROFILER)
+    ScriptMethodResult ExecuteProfileBegin(ScriptArgs const& args);
+    ScriptMethodResult ExecuteProfileEnd(ScriptArgs const& args);
+    ScriptMethodResult ExecuteProfileStartCapture(ScriptArgs const& args);
+    ScriptMethodResult ExecuteProfileStopCapture(ScriptArgs const& args);
+#endif
 };
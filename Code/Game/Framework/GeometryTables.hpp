@@ -0,0 +1,135 @@
+//----------------------------------------------------------------------------------------------------
+// GeometryTables.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <array>
+
+//----------------------------------------------------------------------------------------------------
+// Compile-time unit circle and unit sphere lattices for the runtime geometry builders.
+//
+// The constructors are constexpr: the compiler evaluates the tables, and the binary carries them as read-only
+// data (see UNIT_SPHERE_LATTICE for the one exception). A ring, disc or sphere is then a multiply-add of table entries by radius and center, with no trig at
+// runtime. std::sin and std::cos are not constexpr in C++20, so the tables use their own series below, which
+// are accurate to float precision.
+//
+namespace GeometryTablesDetail
+{
+    constexpr double PI = 3.14159265358979323846;
+
+    //------------------------------------------------------------------------------------------------
+    // Taylor series after folding the angle into [-PI/2, PI/2]. 12 terms there are past float precision.
+    constexpr double Sin(double radians)
+    {
+        while (radians > PI)
+        {
+            radians -= 2.0 * PI;
+        }
+        while (radians < -PI)
+        {
+            radians += 2.0 * PI;
+        }
+        if (radians > PI * 0.5)
+        {
+            radians = PI - radians;
+        }
+        else if (radians < -PI * 0.5)
+        {
+            radians = -PI - radians;
+        }
+
+        double term   = radians;
+        double result = radians;
+        for (int n = 1; n < 12; ++n)
+        {
+            term   *= -radians * radians / static_cast<double>((2 * n) * (2 * n + 1));
+            result += term;
+        }
+        return result;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    constexpr double Cos(double const radians)
+    {
+        return Sin(radians + PI * 0.5);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Entries 0..NUM_SIDES go once around counter-clockwise from +X; the last repeats the first, so side i always
+// runs from entry i to entry i + 1
+template <int NUM_SIDES>
+struct sUnitCircleTable
+{
+    static_assert(NUM_SIDES >= 3, "sUnitCircleTable needs at least three sides");
+
+    std::array<float, NUM_SIDES + 1> m_cos = {};
+    std::array<float, NUM_SIDES + 1> m_sin = {};
+
+    constexpr sUnitCircleTable()
+    {
+        for (int i = 0; i <= NUM_SIDES; ++i)
+        {
+            double const radians = 2.0 * GeometryTablesDetail::PI * static_cast<double>(i % NUM_SIDES) / static_cast<double>(NUM_SIDES);
+            m_cos[i]             = static_cast<float>(GeometryTablesDetail::Cos(radians));
+            m_sin[i]             = static_cast<float>(GeometryTablesDetail::Sin(radians));
+        }
+    }
+};
+
+template <int NUM_SIDES>
+constexpr sUnitCircleTable<NUM_SIDES> UNIT_CIRCLE_TABLE;
+
+//----------------------------------------------------------------------------------------------------
+// Points on the unit sphere, Z up, laid out [stack][slice]. Stacks run from the south pole (stack 0) to the
+// north pole (stack NUM_STACKS), slices around Z from +X. Slice NUM_SLICES repeats slice 0 with u = 1, so the
+// texture seam gets its own lattice points.
+template <int NUM_SLICES, int NUM_STACKS>
+struct sUnitSphereLattice
+{
+    static_assert(NUM_SLICES >= 3 && NUM_STACKS >= 2, "sUnitSphereLattice needs at least 3 slices and 2 stacks");
+
+    static constexpr int POINTS_PER_STACK = NUM_SLICES + 1;
+    static constexpr int POINT_COUNT      = POINTS_PER_STACK * (NUM_STACKS + 1);
+
+    std::array<float, POINT_COUNT> m_x = {};
+    std::array<float, POINT_COUNT> m_y = {};
+    std::array<float, POINT_COUNT> m_z = {};
+    std::array<float, POINT_COUNT> m_u = {};
+    std::array<float, POINT_COUNT> m_v = {};
+
+    constexpr sUnitSphereLattice()
+    {
+        for (int stack = 0; stack <= NUM_STACKS; ++stack)
+        {
+            double const latitude    = GeometryTablesDetail::PI * (static_cast<double>(stack) / static_cast<double>(NUM_STACKS) - 0.5);
+            double const ringRadius  = stack == 0 || stack == NUM_STACKS ? 0.0 : GeometryTablesDetail::Cos(latitude);
+            double const ringHeight  = stack == 0 ? -1.0 : stack == NUM_STACKS ? 1.0 : GeometryTablesDetail::Sin(latitude);
+
+            for (int slice = 0; slice <= NUM_SLICES; ++slice)
+            {
+                double const longitude = 2.0 * GeometryTablesDetail::PI * static_cast<double>(slice % NUM_SLICES) / static_cast<double>(NUM_SLICES);
+                int const    index     = GetIndex(slice, stack);
+
+                m_x[index] = static_cast<float>(ringRadius * GeometryTablesDetail::Cos(longitude));
+                m_y[index] = static_cast<float>(ringRadius * GeometryTablesDetail::Sin(longitude));
+                m_z[index] = static_cast<float>(ringHeight);
+                m_u[index] = static_cast<float>(slice) / static_cast<float>(NUM_SLICES);
+                m_v[index] = static_cast<float>(stack) / static_cast<float>(NUM_STACKS);
+            }
+        }
+    }
+
+    static constexpr int GetIndex(int const slice, int const stack)
+    {
+        return stack * POINTS_PER_STACK + slice;
+    }
+};
+
+// const, not constexpr: a 32 x 16 lattice takes a few hundred thousand constant-evaluation steps, past MSVC's
+// default /constexpr:steps of 100000. Game.vcxproj raises that limit, so it is still constant-initialized into
+// read-only data. A compiler that gives up fills it during static initialization instead of failing the build.
+template <int NUM_SLICES, int NUM_STACKS>
+inline sUnitSphereLattice<NUM_SLICES, NUM_STACKS> const UNIT_SPHERE_LATTICE;
@@ -0,0 +1,69 @@
+//----------------------------------------------------------------------------------------------------
+// IdleGarbageCollector.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/IdleGarbageCollector.hpp"
+
+#include "Engine/Core/Time.hpp"
+#include "Engine/Script/ScriptSubsystem.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/Profiler.hpp"
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+void IdleGarbageCollector::Startup(sIdleGarbageCollectorConfig const& config)
+{
+    m_config                 = config;
+    m_stats                  = sIdleGarbageCollectorStats();
+    m_stats.m_averagePauseMs = m_config.m_initialPauseMs;
+    m_lastCollectionSeconds  = GetCurrentTimeSeconds();
+}
+
+//----------------------------------------------------------------------------------------------------
+void IdleGarbageCollector::Update(double const idleSeconds)
+{
+    if (m_config.m_intervalSeconds <= 0.f || g_scriptSubsystem == nullptr || !g_scriptSubsystem->IsInitialized())
+    {
+        return;
+    }
+
+    double const nowSeconds = GetCurrentTimeSeconds();
+    if (nowSeconds - m_lastCollectionSeconds < m_config.m_intervalSeconds)
+    {
+        return;
+    }
+
+    if (idleSeconds * 1000.0 < m_stats.m_averagePauseMs * m_config.m_idleSafetyFactor)
+    {
+        ++m_stats.m_skippedCount;
+        return;
+    }
+
+    {
+        PROFILE_SCOPE("IdleGarbageCollection");
+        g_scriptSubsystem->ForceGarbageCollection();
+    }
+
+    double const endSeconds = GetCurrentTimeSeconds();
+    float const  pauseMs    = static_cast<float>((endSeconds - nowSeconds) * 1000.0);
+    m_lastCollectionSeconds = endSeconds;
+
+    ++m_stats.m_collectionCount;
+    m_stats.m_lastPauseMs    = pauseMs;
+    m_stats.m_maxPauseMs     = std::max(m_stats.m_maxPauseMs, pauseMs);
+    m_stats.m_averagePauseMs = m_stats.m_collectionCount == 1 ? pauseMs : m_stats.m_averagePauseMs * 0.75f + pauseMs * 0.25f;
+}
+
+//----------------------------------------------------------------------------------------------------
+sIdleGarbageCollectorConfig const& IdleGarbageCollector::GetConfig() const
+{
+    return m_config;
+}
+
+//----------------------------------------------------------------------------------------------------
+sIdleGarbageCollectorStats const& IdleGarbageCollector::GetStats() const
+{
+    return m_stats;
+}
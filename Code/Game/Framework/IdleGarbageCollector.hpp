@@ -0,0 +1,52 @@
+//----------------------------------------------------------------------------------------------------
+// IdleGarbageCollector.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+struct sIdleGarbageCollectorConfig
+{
+    float m_intervalSeconds  = 5.f;      // Collect at most this often; 0 turns idle collection off
+    float m_initialPauseMs   = 4.f;      // Pause assumed until the first collection has been measured
+    float m_idleSafetyFactor = 1.5f;     // Idle time needed, as a multiple of the expected pause
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sIdleGarbageCollectorStats
+{
+    int   m_collectionCount = 0;
+    int   m_skippedCount    = 0;       // Frames a collection was due but the idle time was too short
+    float m_lastPauseMs     = 0.f;
+    float m_averagePauseMs  = 0.f;     // Rolling average; what the next collection is expected to cost
+    float m_maxPauseMs      = 0.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Runs V8 garbage collection in the idle time between frames instead of leaving it to land mid-frame.
+//
+// App::RunMainLoop calls Update() after a frame is finished with the time FrameScheduler is about to sleep.
+// Once m_intervalSeconds have passed since the last collection, and the idle time covers the expected pause,
+// it calls ScriptSubsystem::ForceGarbageCollection() and measures the pause. A frame without enough idle time
+// skips the check until the next one, so an unpaced or overloaded loop (a -benchmark run, a vsync build)
+// never collects here and V8 keeps its own schedule.
+//
+// ForceGarbageCollection() is the only collection entry point the ScriptSubsystem offers, so this is a full
+// collection rather than V8's incremental idle tasks. Spreading it out is the interval's job.
+//
+class IdleGarbageCollector
+{
+public:
+    void Startup(sIdleGarbageCollectorConfig const& config);
+    void Update(double idleSeconds);
+
+    sIdleGarbageCollectorConfig const& GetConfig() const;
+    sIdleGarbageCollectorStats const&  GetStats() const;
+
+private:
+    sIdleGarbageCollectorConfig m_config;
+    sIdleGarbageCollectorStats  m_stats;
+    double                      m_lastCollectionSeconds = 0.0;
+};
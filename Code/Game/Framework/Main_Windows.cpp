@@ -18,14 +18,15 @@ int WINAPI WinMain(HINSTANCE const applicationInstanceHandle,
                    LPSTR const commandLineString, int)
 {
     UNUSED(applicationInstanceHandle)
-    UNUSED(commandLineString)
 
     g_app = new App();
+    g_app->ParseCommandLine(commandLineString);
     g_app->Startup();
     g_app->RunMainLoop();
     g_app->Shutdown();
 
+    int const exitCode = g_app->GetExitCode();
     GAME_SAFE_RELEASE(g_app);
 
-    return 0;
+    return exitCode;
 }
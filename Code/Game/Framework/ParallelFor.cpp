@@ -0,0 +1,257 @@
+//----------------------------------------------------------------------------------------------------
+// ParallelFor.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ParallelFor.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Job.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Lives on the ParallelFor caller's stack; only helpers that started in time ever touch it
+    struct sParallelForTask
+    {
+        ParallelForBody const* m_body       = nullptr;
+        int                    m_count      = 0;
+        int                    m_chunkSize  = 1;
+        int                    m_chunkCount = 0;
+        std::atomic<int>       m_nextChunk{0};
+    };
+
+    //------------------------------------------------------------------------------------------------
+    void RunChunks(sParallelForTask& task)
+    {
+        for (;;)
+        {
+            int const chunk = task.m_nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= task.m_chunkCount)
+            {
+                return;
+            }
+
+            int const begin = chunk * task.m_chunkSize;
+            int const end   = std::min(begin + task.m_chunkSize, task.m_count);
+
+            PROFILE_SCOPE("ParallelFor::Chunk");
+            (*task.m_body)(begin, end);
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // A helper either starts while its ParallelFor is still running (PENDING -> RUNNING -> DONE), or is
+    // cancelled by the caller first (PENDING -> CANCELLED) and then returns from Execute() without touching
+    // the task. The caller therefore only waits on helpers that are actually executing, never on ones stuck
+    // behind unrelated jobs in the shared queue.
+    //
+    enum class eParallelForJobState : uint8_t
+    {
+        PENDING,
+        RUNNING,
+        DONE,
+        CANCELLED
+    };
+
+    //------------------------------------------------------------------------------------------------
+    class ParallelForJob : public Job
+    {
+    public:
+        ParallelForJob()
+            : Job(JOB_TYPE_GENERIC)
+        {
+        }
+
+        void Execute() override
+        {
+            eParallelForJobState expected = eParallelForJobState::PENDING;
+            if (!m_state.compare_exchange_strong(expected, eParallelForJobState::RUNNING, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
+            RunChunks(*m_task);
+
+            // Last touch of the task; the caller may unwind its stack as soon as it sees this
+            m_state.store(eParallelForJobState::DONE, std::memory_order_release);
+        }
+
+        sParallelForTask*                 m_task = nullptr;
+        std::atomic<eParallelForJobState> m_state{eParallelForJobState::PENDING};
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Cancelled helpers still have to reach the front of the JobSystem queue before they come back, so a few
+    // calls' worth may be out at once; past this many per worker the caller just does more of the work itself
+    int constexpr MAX_JOBS_PER_WORKER = 4;
+
+    int                          s_workerCount = 0;
+    std::vector<ParallelForJob*> s_idleJobs;                // Owned here, reused by every ParallelFor call
+    std::vector<ParallelForJob*> s_submittedJobs;           // Helpers of the running call
+    int                          s_jobCount    = 0;         // Idle or still in the JobSystem
+    std::deque<Job*>             s_parkedCompletedJobs;     // Other systems' jobs seen while reclaiming ours
+    bool                         s_isRunning   = false;
+
+    //------------------------------------------------------------------------------------------------
+    // Our jobs go back to the idle list; anything else is left for the game, in order
+    bool TryReclaimJob(Job* const job)
+    {
+        if (ParallelForJob* const parallelForJob = dynamic_cast<ParallelForJob*>(job))
+        {
+            s_idleJobs.push_back(parallelForJob);
+            return true;
+        }
+        return false;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Never waits: whatever has not reached the completed queue yet is picked up by a later call
+    void ReclaimCompletedJobs()
+    {
+        while (Job* const job = g_jobSystem->RetrieveCompletedJob())
+        {
+            if (!TryReclaimJob(job))
+            {
+                s_parkedCompletedJobs.push_back(job);
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ParallelFor(int const count, int const chunkSize, ParallelForBody const& body)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    GUARANTEE_OR_DIE(chunkSize > 0, "ParallelFor: chunkSize must be positive")
+    GUARANTEE_OR_DIE(!s_isRunning, "ParallelFor: nested ParallelFor calls are not supported")
+
+    int const chunkCount = (count + chunkSize - 1) / chunkSize;
+    int       jobCount   = std::min(s_workerCount, chunkCount - 1);
+
+    if (jobCount <= 0 || g_jobSystem == nullptr)
+    {
+        body(0, count);
+        return;
+    }
+
+    s_isRunning = true;
+
+    ReclaimCompletedJobs();
+
+    while (static_cast<int>(s_idleJobs.size()) < jobCount && s_jobCount < s_workerCount * MAX_JOBS_PER_WORKER)
+    {
+        s_idleJobs.push_back(new ParallelForJob());
+        ++s_jobCount;
+    }
+    jobCount = std::min(jobCount, static_cast<int>(s_idleJobs.size()));
+
+    sParallelForTask task;
+    task.m_body       = &body;
+    task.m_count      = count;
+    task.m_chunkSize  = chunkSize;
+    task.m_chunkCount = chunkCount;
+
+    s_submittedJobs.assign(s_idleJobs.end() - jobCount, s_idleJobs.end());
+    s_idleJobs.resize(s_idleJobs.size() - jobCount);
+
+    for (ParallelForJob* const job : s_submittedJobs)
+    {
+        job->m_task = &task;
+        job->m_state.store(eParallelForJobState::PENDING, std::memory_order_relaxed);
+        g_jobSystem->SubmitJob(job);
+    }
+
+    // The caller claims chunks like any helper, so it finishes the loop alone if none of them start
+    RunChunks(task);
+
+    // Barrier: helpers that started may still be inside their last chunk; the rest are cancelled
+    for (ParallelForJob* const job : s_submittedJobs)
+    {
+        eParallelForJobState expected = eParallelForJobState::PENDING;
+        if (job->m_state.compare_exchange_strong(expected, eParallelForJobState::CANCELLED, std::memory_order_acq_rel))
+        {
+            continue;
+        }
+
+        while (job->m_state.load(std::memory_order_acquire) != eParallelForJobState::DONE)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    s_submittedJobs.clear();
+    s_isRunning = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SetParallelForWorkerCount(int const workerCount)
+{
+    s_workerCount = std::max(workerCount, 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+int GetParallelForWorkerCount()
+{
+    return s_workerCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ShutdownParallelFor()
+{
+    // Cancelled helpers may still be queued; they return at once when the workers reach them
+    while (g_jobSystem != nullptr && static_cast<int>(s_idleJobs.size()) < s_jobCount)
+    {
+        ReclaimCompletedJobs();
+        std::this_thread::yield();
+    }
+
+    for (ParallelForJob*& job : s_idleJobs)
+    {
+        GAME_SAFE_RELEASE(job);
+    }
+    s_idleJobs.clear();
+    s_jobCount = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+Job* RetrieveCompletedGameJob()
+{
+    if (!s_parkedCompletedJobs.empty())
+    {
+        Job* const job = s_parkedCompletedJobs.front();
+        s_parkedCompletedJobs.pop_front();
+        return job;
+    }
+
+    if (g_jobSystem == nullptr)
+    {
+        return nullptr;
+    }
+
+    // Helpers cancelled by an earlier ParallelFor can come back at any time; they are ours, not the game's
+    while (Job* const job = g_jobSystem->RetrieveCompletedJob())
+    {
+        if (!TryReclaimJob(job))
+        {
+            return job;
+        }
+    }
+
+    return nullptr;
+}
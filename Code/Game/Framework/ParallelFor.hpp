@@ -0,0 +1,40 @@
+//----------------------------------------------------------------------------------------------------
+// ParallelFor.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <functional>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Job;
+
+//----------------------------------------------------------------------------------------------------
+// Data-parallel loops on top of g_jobSystem.
+//
+// ParallelFor splits [0, count) into chunks of chunkSize and runs body(begin, end) once per chunk. One job per
+// generic worker is submitted, and the calling thread works too. Each participant claims the next unclaimed
+// chunk from a shared atomic cursor until none are left, so a worker that finishes early just takes more chunks
+// and a slow one is never waited on for more than one chunk. The call returns only after every chunk has run,
+// which is the barrier frame code relies on before rendering. A helper still queued behind other jobs when the
+// chunks run out is cancelled rather than waited for, so a busy JobSystem only costs the parallelism.
+//
+// Loops with a single chunk, or when no workers are configured, run inline on the calling thread.
+// Main thread only, and not re-entrant: body must not call ParallelFor itself.
+//
+using ParallelForBody = std::function<void(int begin, int end)>;
+
+void ParallelFor(int count, int chunkSize, ParallelForBody const& body);
+
+// Number of g_jobSystem generic workers ParallelFor may occupy; set once after JobSystem::StartUp
+void SetParallelForWorkerCount(int workerCount);
+int  GetParallelForWorkerCount();
+
+// Frees the reusable jobs; call before g_jobSystem shuts down
+void ShutdownParallelFor();
+
+// ParallelFor reclaims its own jobs from the JobSystem's completed queue. Any other completed job it comes across
+// on the way is parked and handed out here, so game code must retrieve completed jobs through this instead of
+// calling g_jobSystem->RetrieveCompletedJob() directly. Returns nullptr when nothing is waiting.
+Job* RetrieveCompletedGameJob();
@@ -0,0 +1,374 @@
+//----------------------------------------------------------------------------------------------------
+// Profiler.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#if !defined(GAME_DISABLE_PROFILER)
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Per thread; a few hundred zones a frame is typical, so this only fills if the main thread stops draining
+    uint32_t constexpr THREAD_BUFFER_CAPACITY = 16384;
+    size_t constexpr   CAPTURE_MAX_ZONES      = 1 << 20;
+    float constexpr    AVERAGE_SMOOTHING      = 0.05f;     // Weight of the newest frame in m_averageMs
+
+    static_assert((THREAD_BUFFER_CAPACITY & (THREAD_BUFFER_CAPACITY - 1)) == 0, "THREAD_BUFFER_CAPACITY must be a power of two");
+
+    //------------------------------------------------------------------------------------------------
+    struct sProfilerZone
+    {
+        char const* m_name             = nullptr;
+        uint64_t    m_startNanoseconds = 0;
+        uint64_t    m_endNanoseconds   = 0;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Single producer (the owning thread) and single consumer (the main thread in ProfilerEndFrame). The indices
+    // only ever grow; the producer publishes with m_head, the consumer frees space with m_tail.
+    struct sProfilerThreadBuffer
+    {
+        sProfilerZone         m_zones[THREAD_BUFFER_CAPACITY];
+        std::atomic<uint32_t> m_head{0};
+        std::atomic<uint32_t> m_tail{0};
+        std::atomic<int>      m_droppedZones{0};
+        int                   m_threadIndex = 0;
+        String                m_threadName;                  // Guarded by s_registryMutex
+    };
+
+    //------------------------------------------------------------------------------------------------
+    struct sProfilerZoneAccumulator
+    {
+        char const* m_name             = nullptr;
+        uint64_t    m_frameNanoseconds = 0;
+        int         m_frameCallCount   = 0;
+        bool        m_hasAverage       = false;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    struct sProfilerCapturedZone
+    {
+        sProfilerZone m_zone;
+        int           m_threadIndex = 0;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    std::chrono::steady_clock::time_point const s_timeOrigin = std::chrono::steady_clock::now();
+
+    std::mutex                                          s_registryMutex;
+    std::vector<std::unique_ptr<sProfilerThreadBuffer>> s_threadBuffers;     // Never freed, so a buffer outlives its thread
+    thread_local sProfilerThreadBuffer*                 t_threadBuffer = nullptr;
+
+    // Main thread only
+    std::unordered_map<std::string_view, int> s_accumulatorIndexByName;
+    std::vector<sProfilerZoneAccumulator>     s_accumulators;
+    std::vector<sProfilerZoneStats>           s_zoneStats;                   // Parallel to s_accumulators until sorted
+    std::vector<sProfilerZoneStats>           s_sortedZoneStats;
+    int                                       s_droppedZoneCount = 0;
+
+    std::unordered_set<String>                    s_scriptZoneNames;     // Node-based, so c_str() stays put as it grows
+    std::vector<std::pair<char const*, uint64_t>> s_openScriptZones;
+
+    bool                               s_isCapturing             = false;
+    uint64_t                           s_captureStartNanoseconds = 0;
+    std::vector<sProfilerCapturedZone> s_capturedZones;
+
+    //------------------------------------------------------------------------------------------------
+    sProfilerThreadBuffer& GetThreadBuffer()
+    {
+        if (t_threadBuffer == nullptr)
+        {
+            std::unique_ptr<sProfilerThreadBuffer> buffer = std::make_unique<sProfilerThreadBuffer>();
+
+            std::lock_guard<std::mutex> const lock(s_registryMutex);
+            buffer->m_threadIndex = static_cast<int>(s_threadBuffers.size());
+            t_threadBuffer        = buffer.get();
+            s_threadBuffers.push_back(std::move(buffer));
+        }
+
+        return *t_threadBuffer;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void AccumulateZone(sProfilerZone const& zone, int const threadIndex)
+    {
+        auto found = s_accumulatorIndexByName.find(zone.m_name);
+        if (found == s_accumulatorIndexByName.end())
+        {
+            found = s_accumulatorIndexByName.emplace(zone.m_name, static_cast<int>(s_accumulators.size())).first;
+
+            sProfilerZoneAccumulator accumulator;
+            accumulator.m_name = zone.m_name;
+            s_accumulators.push_back(accumulator);
+            s_zoneStats.emplace_back();
+        }
+
+        sProfilerZoneAccumulator& accumulator = s_accumulators[found->second];
+        accumulator.m_frameNanoseconds += zone.m_endNanoseconds - zone.m_startNanoseconds;
+        accumulator.m_frameCallCount++;
+
+        if (s_isCapturing && s_capturedZones.size() < CAPTURE_MAX_ZONES && zone.m_startNanoseconds >= s_captureStartNanoseconds)
+        {
+            s_capturedZones.push_back({zone, threadIndex});
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void DrainThreadBuffers()
+    {
+        // Held only against registration; producers never take it
+        std::lock_guard<std::mutex> const lock(s_registryMutex);
+
+        for (std::unique_ptr<sProfilerThreadBuffer> const& buffer : s_threadBuffers)
+        {
+            uint32_t const head = buffer->m_head.load(std::memory_order_acquire);
+            uint32_t const tail = buffer->m_tail.load(std::memory_order_relaxed);
+
+            for (uint32_t index = tail; index != head; ++index)
+            {
+                AccumulateZone(buffer->m_zones[index & (THREAD_BUFFER_CAPACITY - 1)], buffer->m_threadIndex);
+            }
+
+            buffer->m_tail.store(head, std::memory_order_release);
+            s_droppedZoneCount += buffer->m_droppedZones.exchange(0, std::memory_order_relaxed);
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void AppendJsonString(String& json, char const* text)
+    {
+        json += '"';
+        for (char const* c = text; *c != '\0'; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+            {
+                json += '\\';
+                json += *c;
+            }
+            else if (static_cast<unsigned char>(*c) < 0x20)
+            {
+                json += ' ';
+            }
+            else
+            {
+                json += *c;
+            }
+        }
+        json += '"';
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t ProfilerGetTimeNanoseconds()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_timeOrigin).count());
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProfilerRecordZone(char const* name, uint64_t const startNanoseconds, uint64_t const endNanoseconds)
+{
+    sProfilerThreadBuffer& buffer = GetThreadBuffer();
+
+    uint32_t const head = buffer.m_head.load(std::memory_order_relaxed);
+    uint32_t const tail = buffer.m_tail.load(std::memory_order_acquire);
+
+    if (head - tail >= THREAD_BUFFER_CAPACITY)
+    {
+        buffer.m_droppedZones.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.m_zones[head & (THREAD_BUFFER_CAPACITY - 1)] = {name, startNanoseconds, endNanoseconds};
+    buffer.m_head.store(head + 1, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProfilerSetThreadName(char const* name)
+{
+    sProfilerThreadBuffer& buffer = GetThreadBuffer();
+
+    std::lock_guard<std::mutex> const lock(s_registryMutex);
+    buffer.m_threadName = name;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Totals are inclusive (a zone's time includes the zones nested in it) and summed over threads, so a ParallelFor
+// chunk zone reports the CPU time of all workers together.
+void ProfilerEndFrame()
+{
+    DrainThreadBuffers();
+
+    for (size_t i = 0; i < s_accumulators.size(); ++i)
+    {
+        sProfilerZoneAccumulator& accumulator = s_accumulators[i];
+        sProfilerZoneStats&       stats       = s_zoneStats[i];
+        float const               frameMs     = static_cast<float>(accumulator.m_frameNanoseconds) * 1e-6f;
+
+        stats.m_name          = accumulator.m_name;
+        stats.m_lastMs        = frameMs;
+        stats.m_lastCallCount = accumulator.m_frameCallCount;
+        stats.m_averageMs     = accumulator.m_hasAverage ? stats.m_averageMs + (frameMs - stats.m_averageMs) * AVERAGE_SMOOTHING : frameMs;
+
+        accumulator.m_hasAverage       = true;
+        accumulator.m_frameNanoseconds = 0;
+        accumulator.m_frameCallCount   = 0;
+    }
+
+    s_sortedZoneStats = s_zoneStats;
+    std::sort(s_sortedZoneStats.begin(), s_sortedZoneStats.end(), [](sProfilerZoneStats const& a, sProfilerZoneStats const& b)
+    {
+        return a.m_averageMs > b.m_averageMs;
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<sProfilerZoneStats> const& ProfilerGetZoneStats()
+{
+    return s_sortedZoneStats;
+}
+
+//----------------------------------------------------------------------------------------------------
+int ProfilerGetDroppedZoneCount()
+{
+    return s_droppedZoneCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProfilerBeginScriptZone(String const& name)
+{
+    char const* const internedName = s_scriptZoneNames.insert(name).first->c_str();
+
+    s_openScriptZones.emplace_back(internedName, ProfilerGetTimeNanoseconds());
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProfilerEndScriptZone()
+{
+    if (s_openScriptZones.empty())
+    {
+        return;
+    }
+
+    std::pair<char const*, uint64_t> const zone = s_openScriptZones.back();
+    s_openScriptZones.pop_back();
+
+    ProfilerRecordZone(zone.first, zone.second, ProfilerGetTimeNanoseconds());
+}
+
+//----------------------------------------------------------------------------------------------------
+void ProfilerStartCapture()
+{
+    s_capturedZones.clear();
+    s_captureStartNanoseconds = ProfilerGetTimeNanoseconds();
+    s_isCapturing             = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ProfilerIsCapturing()
+{
+    return s_isCapturing;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Zones still sitting in the thread buffers are drained first, so the capture ends at the call, not at the last
+// frame boundary; they count toward the current frame's stats as usual. Timestamps are microseconds from the start
+// of the capture.
+int ProfilerStopCapture(String const& path)
+{
+    if (!s_isCapturing)
+    {
+        return -1;
+    }
+
+    DrainThreadBuffers();
+    s_isCapturing = false;
+
+    String json;
+    json.reserve(s_capturedZones.size() * 96 + 256);
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    char number[96];
+    bool isFirstEvent = true;
+
+    for (sProfilerCapturedZone const& captured : s_capturedZones)
+    {
+        double const startMicroseconds    = static_cast<double>(captured.m_zone.m_startNanoseconds - s_captureStartNanoseconds) * 1e-3;
+        double const durationMicroseconds = static_cast<double>(captured.m_zone.m_endNanoseconds - captured.m_zone.m_startNanoseconds) * 1e-3;
+
+        json += isFirstEvent ? "\n{\"name\":" : ",\n{\"name\":";
+        AppendJsonString(json, captured.m_zone.m_name);
+        std::snprintf(number, sizeof(number), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}", startMicroseconds, durationMicroseconds, captured.m_threadIndex);
+        json += number;
+        isFirstEvent = false;
+    }
+
+    {
+        std::lock_guard<std::mutex> const lock(s_registryMutex);
+
+        for (std::unique_ptr<sProfilerThreadBuffer> const& buffer : s_threadBuffers)
+        {
+            String const threadName = buffer->m_threadName.empty() ? "Thread " + std::to_string(buffer->m_threadIndex) : buffer->m_threadName;
+
+            std::snprintf(number, sizeof(number), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", buffer->m_threadIndex);
+            json += isFirstEvent ? "\n" : ",\n";
+            json += number;
+            AppendJsonString(json, threadName.c_str());
+            json += "}}";
+            isFirstEvent = false;
+        }
+    }
+
+    json += "\n]}\n";
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        s_capturedZones.clear();
+        return -1;
+    }
+
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+
+    int const zoneCount = static_cast<int>(s_capturedZones.size());
+    s_capturedZones.clear();
+    s_capturedZones.shrink_to_fit();
+
+    return file ? zoneCount : -1;
+}
+
+#else
+
+//----------------------------------------------------------------------------------------------------
+uint64_t ProfilerGetTimeNanoseconds() { return 0; }
+void     ProfilerRecordZone(char const*, uint64_t, uint64_t) {}
+void     ProfilerSetThreadName(char const*) {}
+void     ProfilerEndFrame() {}
+int      ProfilerGetDroppedZoneCount() { return 0; }
+void     ProfilerBeginScriptZone(String const&) {}
+void     ProfilerEndScriptZone() {}
+void     ProfilerStartCapture() {}
+bool     ProfilerIsCapturing() { return false; }
+int      ProfilerStopCapture(String const&) { return -1; }
+
+//----------------------------------------------------------------------------------------------------
+std::vector<sProfilerZoneStats> const& ProfilerGetZoneStats()
+{
+    static std::vector<sProfilerZoneStats> const s_emptyZoneStats;
+    return s_emptyZoneStats;
+}
+
+#endif
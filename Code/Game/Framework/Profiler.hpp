@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------------------------------
+// Profiler.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Scoped-zone frame profiler.
+//
+// PROFILE_SCOPE("Name") times the enclosing scope. On scope exit the zone (name, start, end) is pushed into a
+// ring buffer owned by the calling thread: single producer, single consumer, no locks, no allocation. The main
+// thread drains every ring once per frame in ProfilerEndFrame(), folding zones into per-name rolling averages
+// (ProfilerGetZoneStats) and, while a capture is running, into a list written out as Chrome trace JSON
+// (chrome://tracing or https://ui.perfetto.dev).
+//
+// Names are not copied, so they must outlive the profiler: string literals, or names interned through
+// ProfilerBeginScriptZone. A zone is recorded when it ends, so zones still open at a frame boundary land in
+// the frame they end in. A full ring drops zones, counted in ProfilerGetDroppedZoneCount, rather than block.
+//
+// Defining GAME_DISABLE_PROFILER compiles every PROFILE_SCOPE out and leaves the script bindings unregistered,
+// so instrumented code costs nothing; the per-frame functions below stay callable and do nothing.
+//
+#if defined(GAME_DISABLE_PROFILER)
+#define PROFILE_SCOPE(name)
+#else
+#define PROFILE_SCOPE_CONCAT_INNER(a, b) a##b
+#define PROFILE_SCOPE_CONCAT(a, b)       PROFILE_SCOPE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name)              ProfilerScope const PROFILE_SCOPE_CONCAT(profilerScope_, __LINE__)(name)
+#endif
+
+//----------------------------------------------------------------------------------------------------
+struct sProfilerZoneStats
+{
+    char const* m_name          = nullptr;
+    float       m_averageMs     = 0.f;     // Rolling average of the per-frame total
+    float       m_lastMs        = 0.f;     // Total over the last drained frame
+    int         m_lastCallCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+uint64_t ProfilerGetTimeNanoseconds();
+void     ProfilerRecordZone(char const* name, uint64_t startNanoseconds, uint64_t endNanoseconds);
+
+// Shown for this thread in trace captures; threads that never call it appear as "Thread <n>"
+void ProfilerSetThreadName(char const* name);
+
+// Main thread only
+void                                   ProfilerEndFrame();
+std::vector<sProfilerZoneStats> const& ProfilerGetZoneStats();     // Sorted by m_averageMs, most expensive first
+int                                    ProfilerGetDroppedZoneCount();
+
+// Zones opened and closed from script; names are interned on first use. Unmatched ends are ignored.
+void ProfilerBeginScriptZone(String const& name);
+void ProfilerEndScriptZone();
+
+// Trace capture: every zone between start and stop is kept and written as Chrome trace JSON.
+// Returns the number of zones written, or -1 if no capture was running or the file could not be written.
+void ProfilerStartCapture();
+bool ProfilerIsCapturing();
+int  ProfilerStopCapture(String const& path);
+
+//----------------------------------------------------------------------------------------------------
+class ProfilerScope
+{
+public:
+    explicit ProfilerScope(char const* name)
+        : m_name(name)
+        , m_startNanoseconds(ProfilerGetTimeNanoseconds())
+    {
+    }
+
+    ~ProfilerScope()
+    {
+        ProfilerRecordZone(m_name, m_startNanoseconds, ProfilerGetTimeNanoseconds());
+    }
+
+    ProfilerScope(ProfilerScope const&)            = delete;
+    ProfilerScope& operator=(ProfilerScope const&) = delete;
+
+private:
+    char const* m_name;
+    uint64_t    m_startNanoseconds;
+};
@@ -0,0 +1,524 @@
+//----------------------------------------------------------------------------------------------------
+// ReplaySession.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ReplaySession.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Framework/App.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <sstream>
+
+//----------------------------------------------------------------------------------------------------
+// File layout, little-endian as written by x64:
+//
+//   header  "PJRP", uint32 version, uint32 seed, uint32 reserved
+//   frame   double frameSeconds, float gameDelta, float systemDelta, float cursorX, float cursorY,
+//           uint32 keyChangeCount, keyChangeCount * (uint8 keyCode, uint8 isDown),
+//           uint32 callCount, callCount * (uint8 call, uint8 wordCount, wordCount * uint32)
+//
+// Version 2 widened both counts from uint16, which a heavy submitCommands frame could wrap; version 1
+// files are rejected rather than misread and have to be re-recorded.
+//
+static char const     REPLAY_MAGIC[4]     = {'P', 'J', 'R', 'P'};
+static uint32_t const REPLAY_VERSION      = 2;
+static size_t const   REPLAY_FLUSH_BYTES  = 64 * 1024;
+static char const*    REPLAY_CALL_NAMES[] = {"createCube", "destroyProp", "moveProp", "movePlayerCamera", "submitCommands"};
+
+static_assert(std::size(REPLAY_CALL_NAMES) == static_cast<size_t>(eReplayCall::COUNT), "REPLAY_CALL_NAMES must match eReplayCall");
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+static void AppendValue(std::vector<uint8_t>& bytes, T const& value)
+{
+    size_t const offset = bytes.size();
+    bytes.resize(offset + sizeof(T));
+    std::memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+static bool ReadValue(std::vector<uint8_t> const& bytes, size_t& offset, T& out_value)
+{
+    if (offset + sizeof(T) > bytes.size())
+    {
+        return false;
+    }
+
+    std::memcpy(&out_value, bytes.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+sReplayOptions ParseReplayOptions(String const& commandLine)
+{
+    sReplayOptions options;
+
+    std::istringstream tokens(commandLine);
+    String             token;
+    String const       recordPrefix = "-record=";
+    String const       replayPrefix = "-replay=";
+    String const       seedPrefix   = "-seed=";
+
+    while (tokens >> token)
+    {
+        if (token.rfind(recordPrefix, 0) == 0 && token.size() > recordPrefix.size())
+        {
+            options.m_mode = eReplayMode::RECORD;
+            options.m_path = token.substr(recordPrefix.size());
+        }
+        else if (token.rfind(replayPrefix, 0) == 0 && token.size() > replayPrefix.size())
+        {
+            options.m_mode = eReplayMode::REPLAY;
+            options.m_path = token.substr(replayPrefix.size());
+        }
+        else if (token.rfind(seedPrefix, 0) == 0 && token.size() > seedPrefix.size())
+        {
+            options.m_hasSeed = true;
+            options.m_seed    = static_cast<uint32_t>(std::strtoul(token.c_str() + seedPrefix.size(), nullptr, 10));
+        }
+    }
+
+    return options;
+}
+
+//----------------------------------------------------------------------------------------------------
+char const* GetReplayModeName(eReplayMode const mode)
+{
+    switch (mode)
+    {
+    case eReplayMode::OFF:    return "off";
+    case eReplayMode::RECORD: return "record";
+    case eReplayMode::REPLAY: return "replay";
+    }
+
+    return "unknown";
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ReplaySession::Startup(sReplayOptions const& options)
+{
+    m_options = options;
+    m_seed    = options.m_hasSeed ? options.m_seed : std::random_device{}();
+
+    if (options.m_mode == eReplayMode::REPLAY)
+    {
+        std::ifstream file(options.m_path, std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            return false;
+        }
+
+        m_bytes.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(m_bytes.data()), static_cast<std::streamsize>(m_bytes.size()));
+
+        char     magic[4] = {};
+        uint32_t version  = 0;
+        uint32_t seed     = 0;
+        uint32_t reserved = 0;
+
+        if (!ReadValue(m_bytes, m_readOffset, magic) || std::memcmp(magic, REPLAY_MAGIC, sizeof(magic)) != 0 ||
+            !ReadValue(m_bytes, m_readOffset, version) || version != REPLAY_VERSION ||
+            !ReadValue(m_bytes, m_readOffset, seed) || !ReadValue(m_bytes, m_readOffset, reserved))
+        {
+            return false;
+        }
+
+        if (options.m_hasSeed && options.m_seed != seed)
+        {
+            DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(ReplaySession::Startup)(-seed={} ignored, {} was recorded with seed {})", options.m_seed, options.m_path, seed));
+        }
+
+        m_seed = seed;
+    }
+    else if (options.m_mode == eReplayMode::RECORD)
+    {
+        std::error_code             error;
+        std::filesystem::path const filePath(options.m_path);
+
+        if (filePath.has_parent_path())
+        {
+            std::filesystem::create_directories(filePath.parent_path(), error);
+        }
+
+        m_recordFile.open(filePath, std::ios::binary | std::ios::trunc);
+        if (!m_recordFile)
+        {
+            return false;
+        }
+
+        AppendValue(m_bytes, REPLAY_MAGIC);
+        AppendValue(m_bytes, REPLAY_VERSION);
+        AppendValue(m_bytes, m_seed);
+        AppendValue(m_bytes, uint32_t{0});
+    }
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(ReplaySession::Startup)(mode {})(seed {}){}", GetReplayModeName(options.m_mode), m_seed, options.m_path.empty() ? "" : StringFormat("({})", options.m_path)));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReplaySession::Shutdown()
+{
+    if (m_options.m_mode == eReplayMode::RECORD && m_recordFile.is_open())
+    {
+        FlushRecording();
+        m_recordFile.close();
+
+        DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(ReplaySession::Shutdown)(recorded {} frames to {})", m_frameIndex, m_options.m_path));
+    }
+    else if (m_options.m_mode == eReplayMode::REPLAY && m_readOffset < m_bytes.size())
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(ReplaySession::Shutdown)(quit after {} frames, before the replay ended)", m_frameIndex));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReplaySession::BeginFrame()
+{
+    if (m_options.m_mode == eReplayMode::RECORD)
+    {
+        m_frame.m_keyChanges.clear();
+        m_frame.m_calls.clear();
+
+        for (int keyCode = 0; keyCode < static_cast<int>(m_isKeyDown.size()); ++keyCode)
+        {
+            bool const isDown = g_input->IsKeyDown(static_cast<unsigned char>(keyCode));
+            if (isDown != m_isKeyDown[keyCode])
+            {
+                m_frame.m_keyChanges.push_back(static_cast<uint8_t>(keyCode));
+                m_frame.m_keyChanges.push_back(isDown ? 1 : 0);
+                m_isKeyDown[keyCode] = isDown;
+            }
+        }
+
+        m_frame.m_cursorDelta = g_input->GetCursorClientDelta();
+    }
+    else if (m_options.m_mode == eReplayMode::REPLAY)
+    {
+        if (m_frameIndex == 0)
+        {
+            m_replayStartSeconds = GetCurrentTimeSeconds();
+        }
+
+        m_hasFrame = ReadFrame();
+        m_nextCall = 0;
+
+        if (!m_hasFrame)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i + 1 < m_frame.m_keyChanges.size(); i += 2)
+        {
+            unsigned char const keyCode = m_frame.m_keyChanges[i];
+            bool const          isDown  = m_frame.m_keyChanges[i + 1] != 0;
+
+            if (isDown)
+            {
+                g_input->HandleKeyPressed(keyCode);
+            }
+            else
+            {
+                g_input->HandleKeyReleased(keyCode);
+            }
+
+            m_isKeyDown[keyCode] = isDown;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReplaySession::EndFrame()
+{
+    if (m_options.m_mode == eReplayMode::RECORD)
+    {
+        WriteFrame();
+        ++m_frameIndex;
+
+        if (m_bytes.size() >= REPLAY_FLUSH_BYTES)
+        {
+            FlushRecording();
+        }
+    }
+    else if (m_options.m_mode == eReplayMode::REPLAY)
+    {
+        if (m_hasFrame)
+        {
+            if (m_nextCall < static_cast<int>(m_frame.m_calls.size()))
+            {
+                ReportDesync(StringFormat("{} recorded calls were not made, the next was {}", static_cast<int>(m_frame.m_calls.size()) - m_nextCall, REPLAY_CALL_NAMES[static_cast<int>(m_frame.m_calls[m_nextCall].m_call)]));
+            }
+
+            ++m_frameIndex;
+        }
+
+        if (m_readOffset >= m_bytes.size())
+        {
+            double const seconds = GetCurrentTimeSeconds() - m_replayStartSeconds;
+
+            DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(ReplaySession::EndFrame)(replayed {} frames in {:.3f} s, {:.1f} frames/s)({})",
+                                                                     m_frameIndex,
+                                                                     seconds,
+                                                                     seconds > 0.0 ? static_cast<double>(m_frameIndex) / seconds : 0.0,
+                                                                     m_desyncFrame < 0 ? String("in sync") : StringFormat("desync at frame {}", m_desyncFrame)));
+            App::RequestQuit();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+double ReplaySession::SyncFrameSeconds(double const frameSeconds)
+{
+    if (m_options.m_mode == eReplayMode::RECORD)
+    {
+        m_frame.m_frameSeconds = frameSeconds;
+    }
+    else if (m_hasFrame)
+    {
+        return m_frame.m_frameSeconds;
+    }
+
+    return frameSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReplaySession::SyncScriptDeltas(float& gameDeltaSeconds,
+                                     float& systemDeltaSeconds)
+{
+    if (m_options.m_mode == eReplayMode::RECORD)
+    {
+        m_frame.m_gameDeltaSeconds   = gameDeltaSeconds;
+        m_frame.m_systemDeltaSeconds = systemDeltaSeconds;
+    }
+    else if (m_hasFrame)
+    {
+        gameDeltaSeconds   = m_frame.m_gameDeltaSeconds;
+        systemDeltaSeconds = m_frame.m_systemDeltaSeconds;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 ReplaySession::GetCursorClientDelta() const
+{
+    if (m_hasFrame)
+    {
+        return m_frame.m_cursorDelta;
+    }
+
+    return g_input->GetCursorClientDelta();
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReplaySession::RecordCall(eReplayCall const                  call,
+                               std::initializer_list<sReplayWord> arguments)
+{
+    if (m_options.m_mode == eReplayMode::OFF)
+    {
+        return;
+    }
+
+    sReplayCallRecord record;
+    record.m_call = call;
+
+    for (sReplayWord const& argument : arguments)
+    {
+        if (record.m_wordCount < MAX_CALL_WORDS)
+        {
+            record.m_words[record.m_wordCount++] = argument.m_bits;
+        }
+    }
+
+    AddCall(record);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReplaySession::RecordCommandBuffer(float const* values,
+                                        int const    valueCount)
+{
+    if (m_options.m_mode == eReplayMode::OFF)
+    {
+        return;
+    }
+
+    // FNV-1a over the bytes; the payload can be thousands of values a frame, too much to store
+    uint32_t             hash  = 2166136261u;
+    uint8_t const* const bytes = reinterpret_cast<uint8_t const*>(values);
+
+    for (size_t i = 0; i < static_cast<size_t>(valueCount) * sizeof(float); ++i)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+
+    RecordCall(eReplayCall::SUBMIT_COMMANDS, {valueCount, static_cast<int>(hash)});
+}
+
+//----------------------------------------------------------------------------------------------------
+eReplayMode ReplaySession::GetMode() const
+{
+    return m_options.m_mode;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ReplaySession::IsReplaying() const
+{
+    return m_options.m_mode == eReplayMode::REPLAY;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t ReplaySession::GetSeed() const
+{
+    return m_seed;
+}
+
+//----------------------------------------------------------------------------------------------------
+int ReplaySession::GetFrameIndex() const
+{
+    return m_frameIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+int ReplaySession::GetDesyncFrame() const
+{
+    return m_desyncFrame;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReplaySession::AddCall(sReplayCallRecord const& record)
+{
+    if (m_options.m_mode == eReplayMode::RECORD)
+    {
+        m_frame.m_calls.push_back(record);
+        return;
+    }
+
+    if (!m_hasFrame)
+    {
+        return;
+    }
+
+    if (m_nextCall >= static_cast<int>(m_frame.m_calls.size()))
+    {
+        ReportDesync(StringFormat("unrecorded {} call", REPLAY_CALL_NAMES[static_cast<int>(record.m_call)]));
+        return;
+    }
+
+    sReplayCallRecord const& expected = m_frame.m_calls[m_nextCall++];
+
+    if (expected.m_call != record.m_call || expected.m_wordCount != record.m_wordCount ||
+        !std::equal(record.m_words.begin(), record.m_words.begin() + record.m_wordCount, expected.m_words.begin()))
+    {
+        ReportDesync(StringFormat("{} differs from the recorded {}", REPLAY_CALL_NAMES[static_cast<int>(record.m_call)], REPLAY_CALL_NAMES[static_cast<int>(expected.m_call)]));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReplaySession::WriteFrame()
+{
+    AppendValue(m_bytes, m_frame.m_frameSeconds);
+    AppendValue(m_bytes, m_frame.m_gameDeltaSeconds);
+    AppendValue(m_bytes, m_frame.m_systemDeltaSeconds);
+    AppendValue(m_bytes, m_frame.m_cursorDelta.x);
+    AppendValue(m_bytes, m_frame.m_cursorDelta.y);
+
+    AppendValue(m_bytes, static_cast<uint32_t>(m_frame.m_keyChanges.size() / 2));
+    m_bytes.insert(m_bytes.end(), m_frame.m_keyChanges.begin(), m_frame.m_keyChanges.end());
+
+    AppendValue(m_bytes, static_cast<uint32_t>(m_frame.m_calls.size()));
+    for (sReplayCallRecord const& record : m_frame.m_calls)
+    {
+        AppendValue(m_bytes, static_cast<uint8_t>(record.m_call));
+        AppendValue(m_bytes, record.m_wordCount);
+        for (int i = 0; i < record.m_wordCount; ++i)
+        {
+            AppendValue(m_bytes, record.m_words[i]);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReplaySession::FlushRecording()
+{
+    m_recordFile.write(reinterpret_cast<char const*>(m_bytes.data()), static_cast<std::streamsize>(m_bytes.size()));
+    m_bytes.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+// False at the end of the file; a truncated last frame, from a recording that crashed, also ends the replay
+bool ReplaySession::ReadFrame()
+{
+    if (m_readOffset >= m_bytes.size())
+    {
+        return false;
+    }
+
+    uint32_t keyChangeCount = 0;
+    uint32_t callCount      = 0;
+
+    bool isComplete = ReadValue(m_bytes, m_readOffset, m_frame.m_frameSeconds) &&
+                      ReadValue(m_bytes, m_readOffset, m_frame.m_gameDeltaSeconds) &&
+                      ReadValue(m_bytes, m_readOffset, m_frame.m_systemDeltaSeconds) &&
+                      ReadValue(m_bytes, m_readOffset, m_frame.m_cursorDelta.x) &&
+                      ReadValue(m_bytes, m_readOffset, m_frame.m_cursorDelta.y) &&
+                      ReadValue(m_bytes, m_readOffset, keyChangeCount) &&
+                      keyChangeCount <= (m_bytes.size() - m_readOffset) / 2;
+
+    if (isComplete)
+    {
+        m_frame.m_keyChanges.assign(m_bytes.begin() + static_cast<std::ptrdiff_t>(m_readOffset), m_bytes.begin() + static_cast<std::ptrdiff_t>(m_readOffset + keyChangeCount * size_t{2}));
+        m_readOffset += keyChangeCount * size_t{2};
+        // Every call is at least its two header bytes, so a corrupt count cannot drive a huge resize
+        isComplete = ReadValue(m_bytes, m_readOffset, callCount) && callCount <= (m_bytes.size() - m_readOffset) / 2;
+    }
+
+    m_frame.m_calls.resize(isComplete ? callCount : 0);
+    for (uint32_t i = 0; isComplete && i < callCount; ++i)
+    {
+        sReplayCallRecord& record = m_frame.m_calls[i];
+        uint8_t            call   = 0;
+
+        isComplete = ReadValue(m_bytes, m_readOffset, call) && call < static_cast<uint8_t>(eReplayCall::COUNT) &&
+                     ReadValue(m_bytes, m_readOffset, record.m_wordCount) && record.m_wordCount <= MAX_CALL_WORDS;
+        record.m_call = static_cast<eReplayCall>(call);
+
+        for (int word = 0; isComplete && word < record.m_wordCount; ++word)
+        {
+            isComplete = ReadValue(m_bytes, m_readOffset, record.m_words[word]);
+        }
+    }
+
+    if (!isComplete)
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(ReplaySession::ReadFrame)(frame {} is truncated or corrupt, replay ends there)", m_frameIndex));
+        m_readOffset = m_bytes.size();
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only the first one is logged; everything after it follows from it
+void ReplaySession::ReportDesync(String const& reason)
+{
+    if (m_desyncFrame >= 0)
+    {
+        return;
+    }
+
+    m_desyncFrame = m_frameIndex;
+    DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(ReplaySession)(desync at frame {}: {})", m_frameIndex, reason));
+}
@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------------------------------
+// ReplaySession.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Deterministic record and replay, started from the command line:
+//
+//   ProtogameJS3D.exe -record=Logs/Session.replay [-seed=N]
+//   ProtogameJS3D.exe -replay=Logs/Session.replay
+//
+// Every run has a random seed: -seed=N, the one stored in the replay file, or a fresh one that is logged.
+// Game's SeededRandom (cube colors) and Data/Scripts/core/SeededRandom.js (CubeSpawner, PropMover,
+// CameraShaker) both start from it.
+//
+// Recording appends one record per frame to a compact binary file: the frame, game and system deltas, the keys
+// that went down or up, the cursor delta, and the createCube / destroyProp / moveProp / movePlayerCamera /
+// submitCommands calls script made. submitCommands is stored as its length and a hash, not its payload.
+//
+// Replay hides the window, runs unpaced like -benchmark, and feeds the recorded deltas to the FrameScheduler
+// and the game instead of the wall clock. Key changes go in through InputSystem::HandleKeyPressed/Released and
+// the cursor delta through GetCursorClientDelta(), so Player and Game::UpdateFromKeyBoard see the recorded
+// input. Script runs as usual and must make the same binding calls; the first call that differs is logged
+// as a desync with its frame, and the run exits with code 4. When the frames run out it logs the simulation
+// rate and quits.
+//
+// Not reproduced: controller input, DevConsole typing, and anything that reads a clock directly.
+//
+//----------------------------------------------------------------------------------------------------
+enum class eReplayMode : uint8_t
+{
+    OFF,
+    RECORD,
+    REPLAY
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eReplayCall : uint8_t
+{
+    CREATE_CUBE,            // x, y, z, returned handle
+    DESTROY_PROP,           // handle
+    MOVE_PROP,              // propIndex, x, y, z
+    MOVE_PLAYER_CAMERA,     // x, y, z
+    SUBMIT_COMMANDS,        // value count, FNV-1a of the values
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+// One argument of a recorded call: ints exactly, floats by their bits, so a replayed call matches to the bit
+struct sReplayWord
+{
+    sReplayWord(int const value) : m_bits(static_cast<uint32_t>(value)) {}
+    sReplayWord(float const value) : m_bits(std::bit_cast<uint32_t>(value)) {}
+
+    uint32_t m_bits = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sReplayOptions
+{
+    eReplayMode m_mode    = eReplayMode::OFF;
+    String      m_path;
+    bool        m_hasSeed = false;
+    uint32_t    m_seed    = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+sReplayOptions ParseReplayOptions(String const& commandLine);
+char const*    GetReplayModeName(eReplayMode mode);
+
+//----------------------------------------------------------------------------------------------------
+class ReplaySession
+{
+public:
+    static constexpr int MAX_CALL_WORDS = 4;
+
+    bool Startup(sReplayOptions const& options);     // False if the replay file is missing or not a replay
+    void Shutdown();
+
+    // Around each frame, from App: BeginFrame after the engine's BeginFrame, EndFrame after the frame
+    void BeginFrame();
+    void EndFrame();
+
+    // Pass the live value; record mode stores it, replay mode returns the recorded one instead
+    double SyncFrameSeconds(double frameSeconds);
+    void   SyncScriptDeltas(float& gameDeltaSeconds, float& systemDeltaSeconds);
+
+    Vec2 GetCursorClientDelta() const;
+
+    // No-ops when the session is off; at most MAX_CALL_WORDS arguments
+    void RecordCall(eReplayCall call, std::initializer_list<sReplayWord> arguments);
+    void RecordCommandBuffer(float const* values, int valueCount);
+
+    eReplayMode GetMode() const;
+    bool        IsReplaying() const;
+    uint32_t    GetSeed() const;
+    int         GetFrameIndex() const;
+    int         GetDesyncFrame() const;     // -1 until a replayed call differs from the recording
+
+private:
+    struct sReplayCallRecord
+    {
+        eReplayCall                          m_call      = eReplayCall::COUNT;
+        uint8_t                              m_wordCount = 0;
+        std::array<uint32_t, MAX_CALL_WORDS> m_words     = {};
+    };
+
+    struct sReplayFrame
+    {
+        double                         m_frameSeconds       = 0.0;
+        float                          m_gameDeltaSeconds   = 0.f;
+        float                          m_systemDeltaSeconds = 0.f;
+        Vec2                           m_cursorDelta;
+        std::vector<uint8_t>           m_keyChanges;                 // Key code, then 1 for down or 0 for up
+        std::vector<sReplayCallRecord> m_calls;
+    };
+
+    void AddCall(sReplayCallRecord const& record);
+    void WriteFrame();
+    void FlushRecording();
+    bool ReadFrame();
+    void ReportDesync(String const& reason);
+
+    sReplayOptions        m_options;
+    uint32_t              m_seed               = 0;
+    sReplayFrame          m_frame;                           // Being recorded, or being replayed
+    std::array<bool, 256> m_isKeyDown          = {};         // As of the last frame recorded or replayed
+    int                   m_frameIndex         = 0;
+    int                   m_nextCall           = 0;          // Replay: the next recorded call to match
+    int                   m_desyncFrame        = -1;
+    std::ofstream         m_recordFile;
+    std::vector<uint8_t>  m_bytes;                           // Record: not yet written; replay: the whole file
+    size_t                m_readOffset         = 0;
+    double                m_replayStartSeconds = 0.0;
+    bool                  m_hasFrame           = false;      // Replay: m_frame holds a recorded frame
+};
@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptRuntimeProfile.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptRuntimeProfile.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "ThirdParty/json/json.hpp"
+
+#include <fstream>
+
+//----------------------------------------------------------------------------------------------------
+sScriptRuntimeFeatures GetScriptRuntimeFeatures(eScriptRuntimeProfile const profile)
+{
+    sScriptRuntimeFeatures features;
+
+    switch (profile)
+    {
+    case eScriptRuntimeProfile::PRODUCTION:
+        features.m_isInspectorEnabled      = false;
+        features.m_isDebuggingEnabled      = false;
+        features.m_isHotReloadEnabled      = false;
+        features.m_isScriptRegistryEnabled = false;
+        break;
+    case eScriptRuntimeProfile::SAMPLING:
+        features.m_isDebuggingEnabled      = false;
+        features.m_isHotReloadEnabled      = false;
+        features.m_isScriptRegistryEnabled = false;
+        break;
+    case eScriptRuntimeProfile::DEBUGGING:
+        break;
+    }
+
+    return features;
+}
+
+//----------------------------------------------------------------------------------------------------
+char const* GetScriptRuntimeProfileName(eScriptRuntimeProfile const profile)
+{
+    switch (profile)
+    {
+    case eScriptRuntimeProfile::PRODUCTION: return "production";
+    case eScriptRuntimeProfile::SAMPLING:   return "sampling";
+    case eScriptRuntimeProfile::DEBUGGING:  return "debugging";
+    }
+
+    return "unknown";
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ParseScriptRuntimeProfile(String const&          name,
+                               eScriptRuntimeProfile& out_profile)
+{
+    for (eScriptRuntimeProfile const profile : {eScriptRuntimeProfile::PRODUCTION, eScriptRuntimeProfile::SAMPLING, eScriptRuntimeProfile::DEBUGGING})
+    {
+        if (name == GetScriptRuntimeProfileName(profile))
+        {
+            out_profile = profile;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Read before the LogSubsystem starts, so problems go to the debugger output like LogConfig.json's do
+eScriptRuntimeProfile LoadScriptRuntimeProfile(char const* configPath)
+{
+    eScriptRuntimeProfile profile = eScriptRuntimeProfile::DEBUGGING;
+
+    std::ifstream configFile(configPath);
+    if (!configFile.is_open())
+    {
+        return profile;
+    }
+
+    try
+    {
+        nlohmann::json jsonConfig;
+        configFile >> jsonConfig;
+
+        if (!jsonConfig.contains("scriptRuntime") || !jsonConfig["scriptRuntime"].contains("profile"))
+        {
+            return profile;
+        }
+
+        String const name = jsonConfig["scriptRuntime"]["profile"].get<String>();
+        if (!ParseScriptRuntimeProfile(name, profile))
+        {
+            DebuggerPrintf("Unknown scriptRuntime profile \"%s\" in %s, using debugging\n", name.c_str(), configPath);
+        }
+    }
+    catch (nlohmann::json::exception const& e)
+    {
+        DebuggerPrintf("JSON parsing error in %s: %s\n", configPath, e.what());
+    }
+
+    return profile;
+}
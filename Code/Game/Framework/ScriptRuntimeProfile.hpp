@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptRuntimeProfile.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// How much of the V8 debugging machinery runs, chosen with "scriptRuntime": { "profile": "..." } in
+// Data/Config/WebSocketConfig.json. If the key is missing the profile is "debugging", today's behavior.
+//
+//   production  No inspector thread, no debug mode in the ScriptSubsystem, no hot reload, and no DevTools
+//               script registry: the *ForDebug entry points run scripts as plain ExecuteScript/ExecuteScriptFile.
+//   sampling    The inspector listens, so Chrome DevTools can attach and start the V8 CPU profiler on
+//               demand. Debug mode, hot reload and the script registry stay off.
+//   debugging   Everything on: inspector, debug mode, hot reload, scripts registered in the Sources panel.
+//
+// The inspector, debug mode and hot reload are ScriptSubsystem startup settings. The console command
+// "scriptProfile profile=<name>" switches the script registry at once. The rest only changes on the next
+// launch, and the command says so. -noDevTools still turns the inspector off whatever the profile says.
+//
+enum class eScriptRuntimeProfile : uint8_t
+{
+    PRODUCTION,
+    SAMPLING,
+    DEBUGGING
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptRuntimeFeatures
+{
+    bool m_isInspectorEnabled      = true;
+    bool m_isDebuggingEnabled      = true;
+    bool m_isHotReloadEnabled      = true;
+    bool m_isScriptRegistryEnabled = true;     // The only one that can change while running
+};
+
+//----------------------------------------------------------------------------------------------------
+sScriptRuntimeFeatures GetScriptRuntimeFeatures(eScriptRuntimeProfile profile);
+char const*            GetScriptRuntimeProfileName(eScriptRuntimeProfile profile);
+bool                   ParseScriptRuntimeProfile(String const& name, eScriptRuntimeProfile& out_profile);
+
+// DEBUGGING if the file or key is missing; an unknown name falls back to DEBUGGING with a warning
+eScriptRuntimeProfile LoadScriptRuntimeProfile(char const* configPath);
@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------------------------------------
+// SeededRandom.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// Mulberry32: a 32-bit state, a handful of integer ops per number, and the same sequence on every compiler.
+// Data/Scripts/core/SeededRandom.js is the same generator, so both sides of a run are reproduced from the one
+// seed ReplaySession picks (see ReplaySession.hpp). Each side still owns its own stream.
+//
+class SeededRandom
+{
+public:
+    explicit SeededRandom(uint32_t const seed = 0)
+        : m_state(seed)
+    {
+    }
+
+    uint32_t RollRandomUint()
+    {
+        m_state += 0x6D2B79F5u;
+
+        uint32_t value = m_state;
+        value          = (value ^ (value >> 15)) * (value | 1u);
+        value         ^= value + (value ^ (value >> 7)) * (value | 61u);
+        return value ^ (value >> 14);
+    }
+
+    // [minInclusive, maxInclusive]; the modulo bias is far below anything gameplay can notice
+    int RollRandomIntInRange(int const minInclusive, int const maxInclusive)
+    {
+        uint32_t const range = static_cast<uint32_t>(maxInclusive - minInclusive) + 1u;
+        return minInclusive + static_cast<int>(RollRandomUint() % range);
+    }
+
+    // [0, 1)
+    float RollRandomFloatZeroToOne()
+    {
+        return static_cast<float>(RollRandomUint() >> 8) * (1.f / 16777216.f);
+    }
+
+private:
+    uint32_t m_state = 0;
+};
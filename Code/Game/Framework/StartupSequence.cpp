@@ -0,0 +1,167 @@
+//----------------------------------------------------------------------------------------------------
+// StartupSequence.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/StartupSequence.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Job.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/ParallelFor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+//----------------------------------------------------------------------------------------------------
+class StartupTaskJob : public Job
+{
+public:
+    StartupTaskJob(StartupTaskBody body, bool const isIO)
+        : Job(isIO ? JOB_TYPE_IO : JOB_TYPE_GENERIC)
+        , m_body(std::move(body))
+    {
+    }
+
+    void Execute() override
+    {
+        double const startSeconds = GetCurrentTimeSeconds();
+        m_body();
+        m_runMs = (GetCurrentTimeSeconds() - startSeconds) * 1000.0;
+
+        m_isDone.store(true, std::memory_order_release);
+    }
+
+    StartupTaskBody   m_body;
+    double            m_runMs = 0.0;
+    std::atomic<bool> m_isDone{false};
+};
+
+//----------------------------------------------------------------------------------------------------
+StartupSequence::StartupSequence()
+    : m_startSeconds(GetCurrentTimeSeconds())
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+StartupSequence::~StartupSequence()
+{
+    GUARANTEE_OR_DIE(m_submittedJobCount == 0, "StartupSequence: WaitForAllTasks() must run before the sequence goes away")
+}
+
+//----------------------------------------------------------------------------------------------------
+void StartupSequence::BeginStage(char const* name)
+{
+    EndStage();
+
+    m_currentStageName  = name;
+    m_stageStartSeconds = GetCurrentTimeSeconds();
+}
+
+//----------------------------------------------------------------------------------------------------
+void StartupSequence::EndStage()
+{
+    if (m_currentStageName == nullptr)
+    {
+        return;
+    }
+
+    m_stages.push_back({m_currentStageName, (GetCurrentTimeSeconds() - m_stageStartSeconds) * 1000.0});
+    m_currentStageName = nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+int StartupSequence::StartTask(char const* name, StartupTaskBody body, bool const isIO)
+{
+    StartupTaskJob* const job = new StartupTaskJob(std::move(body), isIO);
+
+    if (g_jobSystem == nullptr)
+    {
+        job->Execute();
+    }
+    else
+    {
+        g_jobSystem->SubmitJob(job);
+        ++m_submittedJobCount;
+    }
+
+    m_tasks.push_back({name, job});
+
+    return static_cast<int>(m_tasks.size()) - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void StartupSequence::WaitForTask(int const taskIndex)
+{
+    sStartupTask& task = m_tasks[taskIndex];
+    if (task.m_isWaited)
+    {
+        return;
+    }
+
+    double const startSeconds = GetCurrentTimeSeconds();
+
+    while (!task.m_job->m_isDone.load(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+
+    task.m_waitedMs = (GetCurrentTimeSeconds() - startSeconds) * 1000.0;
+    task.m_isWaited = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void StartupSequence::WaitForAllTasks()
+{
+    for (int i = 0; i < static_cast<int>(m_tasks.size()); ++i)
+    {
+        WaitForTask(i);
+    }
+
+    // Jobs reach the completed queue a moment after Execute() returns. ParallelFor parks ours if it gets there first.
+    while (m_submittedJobCount > 0)
+    {
+        Job* const job = RetrieveCompletedGameJob();
+        if (job == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        GUARANTEE_OR_DIE(dynamic_cast<StartupTaskJob*>(job) != nullptr, "StartupSequence: found a completed job that is not a startup task")
+        --m_submittedJobCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void StartupSequence::Finish()
+{
+    EndStage();
+    WaitForAllTasks();
+
+    for (sStartupStage const& stage : m_stages)
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(StartupSequence)(stage)({}: {:.1f} ms)", stage.m_name, stage.m_elapsedMs));
+    }
+
+    for (sStartupTask& task : m_tasks)
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(StartupSequence)(task)({}: {:.1f} ms on a worker, main thread waited {:.1f} ms)", task.m_name, task.m_job->m_runMs, task.m_waitedMs));
+        GAME_SAFE_RELEASE(task.m_job);
+    }
+    m_tasks.clear();
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(StartupSequence)(startup took {:.1f} ms)", GetElapsedMs()));
+}
+
+//----------------------------------------------------------------------------------------------------
+double StartupSequence::GetElapsedMs() const
+{
+    return (GetCurrentTimeSeconds() - m_startSeconds) * 1000.0;
+}
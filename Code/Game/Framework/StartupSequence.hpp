@@ -0,0 +1,70 @@
+//----------------------------------------------------------------------------------------------------
+// StartupSequence.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <functional>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class StartupTaskJob;
+
+//----------------------------------------------------------------------------------------------------
+// Timed startup stages, some of them overlapped on g_jobSystem.
+//
+// BeginStage("Name") ends the previous main-thread stage and starts timing the next one. StartTask("Name", body)
+// runs body on a JobSystem worker while the main thread carries on; WaitForTask() blocks until it is done, and
+// only the blocked time counts against the main thread. The dependency graph is the order of the calls: start a
+// task as soon as its inputs exist and wait for it right before the first thing that needs its result.
+//
+// WaitForAllTasks() waits for every task and takes its job back from the completed queue. Call it before any
+// other game code submits jobs (ParallelFor aside), since until then every completed job is assumed to be ours.
+// Finish() does the same, then logs one line per stage and task plus the total.
+//
+using StartupTaskBody = std::function<void()>;
+
+//----------------------------------------------------------------------------------------------------
+class StartupSequence
+{
+public:
+    StartupSequence();
+    ~StartupSequence();
+
+    StartupSequence(StartupSequence const&)            = delete;
+    StartupSequence& operator=(StartupSequence const&) = delete;
+
+    void BeginStage(char const* name);
+    void EndStage();
+
+    // Runs inline when the JobSystem is not up yet. isIO selects an I/O worker instead of a generic one.
+    int  StartTask(char const* name, StartupTaskBody body, bool isIO = false);
+    void WaitForTask(int taskIndex);
+    void WaitForAllTasks();
+
+    void   Finish();
+    double GetElapsedMs() const;
+
+private:
+    struct sStartupStage
+    {
+        char const* m_name      = nullptr;
+        double      m_elapsedMs = 0.0;
+    };
+
+    struct sStartupTask
+    {
+        char const*     m_name     = nullptr;
+        StartupTaskJob* m_job      = nullptr;
+        double          m_waitedMs = 0.0;     // Main thread time spent blocked on it
+        bool            m_isWaited = false;
+    };
+
+    double                     m_startSeconds      = 0.0;
+    double                     m_stageStartSeconds = 0.0;
+    char const*                m_currentStageName  = nullptr;
+    std::vector<sStartupStage> m_stages;
+    std::vector<sStartupTask>  m_tasks;
+    int                        m_submittedJobCount = 0;
+};
@@ -15,8 +15,9 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/Time.hpp"
 #include "Engine/Input/InputSystem.hpp"
-#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Math/MathUtils.hpp"
 #include "Engine/Platform/Window.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Renderer/DebugRenderSystem.hpp"
@@ -25,17 +26,53 @@
 #include "Engine/Script/ScriptSubsystem.hpp"
 #include "Engine/Script/ModuleLoader.hpp"
 #include "Game/Gameplay/Player.hpp"
-#include "Game/Gameplay/Prop.hpp"
+#include "Game/Gameplay/PropCommand.hpp"
+#include "Game/Gameplay/PropPool.hpp"
+#include "Game/Gameplay/PropRenderer.hpp"
+#include "Game/Gameplay/PropSpatialGrid.hpp"
+#include "Game/Gameplay/PropTextureStreamer.hpp"
+#include "Game/Framework/AllocationTracker.hpp"
 #include "Game/Framework/App.hpp"
+#include "Game/Framework/DebugTextOverlay.hpp"
+#include "Game/Framework/DeferredLog.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/Profiler.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <fstream>
-#include <sstream>
 
 #include "Engine/Audio/AudioSystem.hpp"
 
+//----------------------------------------------------------------------------------------------------
+// Per-frame JavaScript entry points.
+// These sources never change, so V8 compiles each of them once and serves every later frame from its
+// compilation cache. The frame deltas are pulled back through GameScriptInterface properties instead of
+// being formatted into the source, and globalThis.JSEngine is looked up on every call so a hot-reloaded
+// JSEngine instance is picked up without re-binding anything.
+//
+static String const JS_UPDATE_ENTRY = "globalThis.JSEngine.update(game.gameDeltaSeconds, game.systemDeltaSeconds, game.frameStepCount);";
+static String const JS_RENDER_ENTRY = "globalThis.JSEngine.render();";
+
+//----------------------------------------------------------------------------------------------------
+// Opcodes and handles arrive as floats from script. Only a finite, whole value in [0, maxExclusive) is accepted;
+// anything else (NaN, 3.5, -1, 1e30) would turn into an arbitrary opcode or handle through static_cast.
+//
+static bool TryGetPropCommandInteger(float const value, int const maxExclusive, int& out_value)
+{
+    if (!std::isfinite(value) || value != std::floor(value) || value < 0.f || value >= static_cast<float>(maxExclusive))
+    {
+        return false;
+    }
+
+    out_value = static_cast<int>(value);
+    return true;
+}
+
 //----------------------------------------------------------------------------------------------------
 Game::Game()
+    : m_random(g_app->GetReplaySession().GetSeed())
 {
     DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(Game::Game)(start)"));
 
@@ -54,6 +91,8 @@ Game::Game()
     m_screenCamera->SetNormalizedViewport(AABB2::ZERO_TO_ONE);
     m_gameClock = new Clock(Clock::GetSystemClock());
 
+    InitDebugTextOverlay();
+
     DebugAddWorldBasis(Mat44(), -1.f);
 
     Mat44 transform;
@@ -68,8 +107,6 @@ Game::Game()
     DebugAddWorldText("Z-Up", transform, 0.25f, Vec2(1.f, 0.f), -1.f, Rgba8::BLUE);
 
     DAEMON_LOG(LogGame, eLogVerbosity::Log, "(Game::Game)(end)");
-
-    ExecuteJavaScriptFile("Data/Scripts/test_scripts.js");
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -77,8 +114,11 @@ Game::~Game()
 {
     DAEMON_LOG(LogGame, eLogVerbosity::Log, "(Game::~Game)(start)");
 
-    m_props.clear();
-
+    GAME_SAFE_RELEASE(m_debugTextOverlay);
+    GAME_SAFE_RELEASE(m_propTextureStreamer);
+    GAME_SAFE_RELEASE(m_propSpatialGrid);
+    GAME_SAFE_RELEASE(m_propRenderer);
+    GAME_SAFE_RELEASE(m_propPool);
     GAME_SAFE_RELEASE(m_gameClock);
 
     GAME_SAFE_RELEASE(m_player);
@@ -94,15 +134,33 @@ void Game::PostInit()
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::UpdateJS()
+void Game::UpdateJS(sFrameSteps const& frameSteps)
 {
+    PROFILE_SCOPE("Game::UpdateJS");
+
+    m_frameSteps = frameSteps;
+
     // Temporarily disable JavaScript calls to test for buffer overrun
     // Update JavaScript framework - this will call the actual C++ Update(float,float)
     if (g_scriptSubsystem && g_scriptSubsystem->IsInitialized())
     {
-        float const gameDeltaSeconds   = static_cast<float>(m_gameClock->GetDeltaSeconds());
-        float const systemDeltaSeconds = static_cast<float>(Clock::GetSystemClock().GetDeltaSeconds());
-        ExecuteJavaScriptCommand(StringFormat("globalThis.JSEngine.update({}, {});", std::to_string(gameDeltaSeconds), std::to_string(systemDeltaSeconds)));
+        if (IsFixedTimestep())
+        {
+            // Script sees the simulated time this frame, so deltas and frame counts add up to whole steps
+            float const simulatedSeconds = static_cast<float>(m_frameSteps.m_stepCount) * m_frameSteps.m_stepSeconds;
+            m_jsGameDeltaSeconds         = m_gameClock->IsPaused() ? 0.f : simulatedSeconds * m_gameClock->GetTimeScale();
+            m_jsSystemDeltaSeconds       = simulatedSeconds;
+        }
+        else
+        {
+            m_jsGameDeltaSeconds   = static_cast<float>(m_gameClock->GetDeltaSeconds());
+            m_jsSystemDeltaSeconds = static_cast<float>(Clock::GetSystemClock().GetDeltaSeconds());
+        }
+
+        // Recorded here, or replaced by the recording, so script and Game::Update see the same deltas either way
+        g_app->GetReplaySession().SyncScriptDeltas(m_jsGameDeltaSeconds, m_jsSystemDeltaSeconds);
+        ALLOCATION_TAG("Script");
+        ExecuteJavaScriptFrameEntry(JS_UPDATE_ENTRY);
     }
     // else
     // {
@@ -114,16 +172,25 @@ void Game::UpdateJS()
 
     // Handle additional JavaScript commands via keyboard
     // HandleJavaScriptCommands();
+
+    // Once per frame, after every step, so the snapshot holds everything this frame did; drawn by the next Render()
+    if (m_propRenderer->IsPipelined())
+    {
+        m_propRenderer->CaptureFrame(*m_propPool, *m_propSpatialGrid, *m_player->GetCamera(), m_player->GetViewFrustum(), GetRenderInterpolation());
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
 void Game::RenderJS()
 {
+    PROFILE_SCOPE("Game::RenderJS");
+
     // Temporarily disable JavaScript calls to test for buffer overrun
     // Render JavaScript framework - this will call the actual C++ Render(float,float)
     if (g_scriptSubsystem && g_scriptSubsystem->IsInitialized())
     {
-        ExecuteJavaScriptCommand(StringFormat("globalThis.JSEngine.render();"));
+        ALLOCATION_TAG("Script");
+        ExecuteJavaScriptFrameEntry(JS_RENDER_ENTRY);
     }
     // else
     // {
@@ -461,6 +528,22 @@ void Game::UpdateFromKeyBoard()
             m_gameClock->SetTimeScale(1.f);
         }
 
+        // F6, not F3: HandleJavaScriptCommands already runs toggleShouldRender() on F3
+        if (g_input->WasKeyJustPressed(KEYCODE_F6))
+        {
+            m_isProfilerOverlayVisible = !m_isProfilerOverlayVisible;
+        }
+
+        if (g_input->WasKeyJustPressed(KEYCODE_F4))
+        {
+            ToggleProfilerCapture();
+        }
+
+        if (g_input->WasKeyJustPressed(KEYCODE_F5))
+        {
+            m_isAllocationOverlayVisible = !m_isAllocationOverlayVisible;
+        }
+
         if (g_input->WasKeyJustPressed(NUMCODE_1))
         {
             Vec3 forward;
@@ -578,35 +661,247 @@ void Game::UpdateFromController()
 //----------------------------------------------------------------------------------------------------
 void Game::UpdateEntities(float const gameDeltaSeconds, float const systemDeltaSeconds) const
 {
-    if (m_player)
-    {
-        m_player->Update(systemDeltaSeconds);
-    }
+    PROFILE_SCOPE("Game::UpdateEntities");
 
-    for (Prop* prop : m_props)
+    if (!IsFixedTimestep())
     {
-        if (prop)
+        if (m_player)
         {
-            prop->Update(gameDeltaSeconds);
+            m_player->Update(systemDeltaSeconds);
         }
+
+        StepProps(gameDeltaSeconds);
     }
+    else
+    {
+        // The camera follows input, not the simulation: it moves once a frame by real time so it stays smooth on
+        // frames that run no step. The frame delta, not the clock's, so a replay moves it by the recorded time.
+        if (m_player)
+        {
+            m_player->Update(m_frameSteps.m_frameSeconds);
+        }
+
+        int const   stepCount       = m_frameSteps.m_stepCount;
+        float const stepGameSeconds = stepCount > 0 ? gameDeltaSeconds / static_cast<float>(stepCount) : 0.f;
 
-    m_props[0]->m_orientation.m_pitchDegrees += 30.f * gameDeltaSeconds;
-    m_props[0]->m_orientation.m_rollDegrees += 30.f * gameDeltaSeconds;
+        for (int step = 0; step < stepCount; ++step)
+        {
+            m_propPool->StorePreviousTransforms();
+            StepProps(stepGameSeconds);
+        }
+    }
 
+    // Driven by total time rather than stepped, so it is already smooth
     float const time       = static_cast<float>(m_gameClock->GetTotalSeconds());
     float const colorValue = (sinf(time) + 1.0f) * 0.5f * 255.0f;
 
-    m_props[1]->m_color.r = static_cast<unsigned char>(colorValue);
-    m_props[1]->m_color.g = static_cast<unsigned char>(colorValue);
-    m_props[1]->m_color.b = static_cast<unsigned char>(colorValue);
+    if (int const cube = m_propPool->GetDenseIndex(m_pulsingCubeHandle); cube >= 0)
+    {
+        m_propPool->m_colors[cube].r = static_cast<unsigned char>(colorValue);
+        m_propPool->m_colors[cube].g = static_cast<unsigned char>(colorValue);
+        m_propPool->m_colors[cube].b = static_cast<unsigned char>(colorValue);
+    }
+
+    ALLOCATION_TAG("DebugText");
+
+    UpdateFrameStatsText();
+
+    if (m_isProfilerOverlayVisible)
+    {
+        RenderProfilerOverlay();
+    }
+
+    if (m_isAllocationOverlayVisible)
+    {
+        RenderAllocationOverlay();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::InitDebugTextOverlay()
+{
+    m_debugTextOverlay = new DebugTextOverlay(*g_bitmapFont);
+
+    Vec2 const frameStatsMins = m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 0.f);
+
+    m_debugTextLines.m_gameTime   = m_debugTextOverlay->AddLine(frameStatsMins - Vec2(0.f, 20.f), 20.f);
+    m_debugTextLines.m_systemTime = m_debugTextOverlay->AddLine(frameStatsMins - Vec2(0.f, 40.f), 20.f);
+    m_debugTextLines.m_fps        = m_debugTextOverlay->AddLine(frameStatsMins - Vec2(0.f, 60.f), 20.f);
+    m_debugTextLines.m_timeScale  = m_debugTextOverlay->AddLine(frameStatsMins - Vec2(0.f, 80.f), 20.f);
+    m_debugTextLines.m_props      = m_debugTextOverlay->AddLine(frameStatsMins - Vec2(0.f, 100.f), 20.f);
+    m_debugTextLines.m_frameCost  = m_debugTextOverlay->AddLine(frameStatsMins - Vec2(0.f, 120.f), 20.f);
+
+    m_debugTextLines.m_screenDimensions = m_debugTextOverlay->AddLine(Vec2(0.f, 0.f), 20.f);
+    m_debugTextLines.m_windowDimensions = m_debugTextOverlay->AddLine(Vec2(0.f, 20.f), 20.f);
+    m_debugTextLines.m_clientDimensions = m_debugTextOverlay->AddLine(Vec2(0.f, 40.f), 20.f);
+    m_debugTextLines.m_windowPosition   = m_debugTextOverlay->AddLine(Vec2(0.f, 60.f), 20.f);
+    m_debugTextLines.m_clientPosition   = m_debugTextOverlay->AddLine(Vec2(0.f, 80.f), 20.f);
+    m_debugTextLines.m_scriptStatus     = m_debugTextOverlay->AddLine(Vec2(0.f, 100.f), 20.f);
+    m_debugTextLines.m_scriptError      = m_debugTextOverlay->AddLine(Vec2(0.f, 120.f), 15.f, Rgba8::RED);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::UpdateFrameStatsText() const
+{
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_gameTime, "GameTime:   %.2f", m_gameClock->GetTotalSeconds());
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_systemTime, "SystemTime: %.2f", Clock::GetSystemClock().GetTotalSeconds());
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_fps, "FPS:        %.2f", 1.f / m_gameClock->GetDeltaSeconds());
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_timeScale, "Scale:      %.2f", m_gameClock->GetTimeScale());
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_props, "Props:      %d (%d visible, %d draws, %d binds)", m_propPool->GetCount(), m_propRenderer->GetLastVisibleCount(), m_propRenderer->GetLastDrawCallCount(), m_propRenderer->GetLastStateChangeCount());
+
+    // Rolling average, so the line settles instead of changing every frame
+    float jsUpdateMs = 0.f;
+    for (sProfilerZoneStats const& stats : ProfilerGetZoneStats())
+    {
+        if (std::strcmp(stats.m_name, "Game::UpdateJS") == 0)
+        {
+            jsUpdateMs = stats.m_averageMs;
+            break;
+        }
+    }
+
+    sAllocationFrameStats const& allocations = AllocationTrackerGetLastFrame();
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_frameCost, "Frame:      JS %.2f ms, %llu allocs (%llu B)", jsUpdateMs, allocations.m_allocationCount, allocations.m_allocatedBytes);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::UpdateWindowStatsText() const
+{
+    Vec2 const screenDimensions = Window::s_mainWindow->GetScreenDimensions();
+    Vec2 const windowDimensions = Window::s_mainWindow->GetWindowDimensions();
+    Vec2 const clientDimensions = Window::s_mainWindow->GetClientDimensions();
+    Vec2 const windowPosition   = Window::s_mainWindow->GetWindowPosition();
+    Vec2 const clientPosition   = Window::s_mainWindow->GetClientPosition();
+
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_screenDimensions, "ScreenDimensions=(%.1f,%.1f)", screenDimensions.x, screenDimensions.y);
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_windowDimensions, "WindowDimensions=(%.1f,%.1f)", windowDimensions.x, windowDimensions.y);
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_clientDimensions, "ClientDimensions=(%.1f,%.1f)", clientDimensions.x, clientDimensions.y);
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_windowPosition, "WindowPosition=(%.1f,%.1f)", windowPosition.x, windowPosition.y);
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_clientPosition, "ClientPosition=(%.1f,%.1f)", clientPosition.x, clientPosition.y);
+
+    if (g_scriptSubsystem == nullptr)
+    {
+        return;
+    }
+
+    m_debugTextOverlay->SetLine(m_debugTextLines.m_scriptStatus, g_scriptSubsystem->IsInitialized() ? "JS:Initialized" : "JS:UnInitialized");
+    m_debugTextOverlay->SetText(m_debugTextLines.m_scriptError, g_scriptSubsystem->HasError() ? "JS錯誤: " + g_scriptSubsystem->GetLastError() : String());
+}
+
+//----------------------------------------------------------------------------------------------------
+// Most expensive zones by rolling average, as of the last ProfilerEndFrame(); times include nested zones
+void Game::RenderProfilerOverlay() const
+{
+    int constexpr MAX_ZONE_LINES = 12;
+
+    std::vector<sProfilerZoneStats> const& zoneStats = ProfilerGetZoneStats();
+    Vec2 const                             topLeft   = m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 150.f);
+
+    String const header = Stringf("Profiler (F6): avg ms / last ms / calls%s", ProfilerIsCapturing() ? " (capturing, F4 to stop)" : "");
+    DebugAddScreenText(header, topLeft, 16.f, Vec2::ZERO, 0.f, Rgba8::YELLOW, Rgba8::YELLOW);
+
+    int const lineCount = std::min(static_cast<int>(zoneStats.size()), MAX_ZONE_LINES);
+
+    for (int i = 0; i < lineCount; ++i)
+    {
+        sProfilerZoneStats const& stats = zoneStats[i];
+        String const              line  = Stringf("%-28.28s %6.2f %6.2f %5d", stats.m_name, stats.m_averageMs, stats.m_lastMs, stats.m_lastCallCount);
+
+        DebugAddScreenText(line, topLeft - Vec2(0.f, 18.f * static_cast<float>(i + 1)), 16.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    }
+
+    sIdleGarbageCollectorStats const& gcStats = g_app->GetIdleGarbageCollectorStats();
+    String const                      gcLine  = Stringf("Idle GC: %d runs, last %.2f ms, max %.2f ms, %d skipped", gcStats.m_collectionCount, gcStats.m_lastPauseMs, gcStats.m_maxPauseMs, gcStats.m_skippedCount);
+    DebugAddScreenText(gcLine, topLeft - Vec2(0.f, 18.f * static_cast<float>(lineCount + 1)), 16.f, Vec2::ZERO, 0.f, Rgba8::YELLOW, Rgba8::YELLOW);
+
+    if (int const droppedZoneCount = ProfilerGetDroppedZoneCount(); droppedZoneCount > 0)
+    {
+        DebugAddScreenText(Stringf("Dropped zones: %d", droppedZoneCount), topLeft - Vec2(0.f, 18.f * static_cast<float>(lineCount + 2)), 16.f, Vec2::ZERO, 0.f, Rgba8::RED, Rgba8::RED);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Counts are for the last completed frame, this overlay's own strings included (tagged DebugText)
+void Game::RenderAllocationOverlay() const
+{
+    sAllocationFrameStats const& frame   = AllocationTrackerGetLastFrame();
+    Vec2 const                   topLeft = Vec2(10.f, m_screenCamera->GetOrthographicTopRight().y - 20.f);
+
+    int const    budget     = AllocationTrackerGetFrameBudget();
+    String const budgetText = budget < 0 ? String("no budget") : Stringf("budget %d%s, %d frames over", budget, AllocationTrackerIsBudgetArmed() ? "" : " (disarmed)", AllocationTrackerGetOverBudgetFrameCount());
+    Rgba8 const  color      = budget >= 0 && frame.m_allocationCount > static_cast<uint64_t>(budget) ? Rgba8::RED : Rgba8::YELLOW;
 
-    m_props[2]->m_orientation.m_yawDegrees += 45.f * gameDeltaSeconds;
+    DebugAddScreenText(Stringf("Allocations: %llu (%llu bytes), %llu frees, %s", frame.m_allocationCount, frame.m_allocatedBytes, frame.m_freeCount, budgetText.c_str()), topLeft, 16.f, Vec2::ZERO, 0.f, color, color);
 
-    DebugAddScreenText(Stringf("GameTime:   %.2f", m_gameClock->GetTotalSeconds()), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 20.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
-    DebugAddScreenText(Stringf("SystemTime: %.2f", Clock::GetSystemClock().GetTotalSeconds()), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 40.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
-    DebugAddScreenText(Stringf("FPS:        %.2f", 1.f / m_gameClock->GetDeltaSeconds()), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 60.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
-    DebugAddScreenText(Stringf("Scale:      %.2f", m_gameClock->GetTimeScale()), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 80.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    int line = 1;
+    for (int i = 0; i < frame.m_tagCount; ++i)
+    {
+        sAllocationTagStats const& tag = frame.m_tags[i];
+        if (tag.m_allocationCount == 0)
+        {
+            continue;
+        }
+
+        DebugAddScreenText(Stringf("%-12s %6llu %9llu B", tag.m_name, tag.m_allocationCount, tag.m_allocatedBytes), topLeft - Vec2(0.f, 18.f * static_cast<float>(line)), 16.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+        ++line;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// F4 starts a capture and the next F4 writes it out; open the file in chrome://tracing or ui.perfetto.dev
+void Game::ToggleProfilerCapture() const
+{
+    if (!ProfilerIsCapturing())
+    {
+        ProfilerStartCapture();
+        DebugAddMessage("Profiler capture started (F4 to stop)", 2.f);
+        return;
+    }
+
+    String const path      = "Logs/ProfilerTrace.json";
+    int const    zoneCount = ProfilerStopCapture(path);
+
+    if (zoneCount < 0)
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(Game::ToggleProfilerCapture)(failed to write {})", path));
+        return;
+    }
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(Game::ToggleProfilerCapture)(wrote {} zones to {})", zoneCount, path));
+    DebugAddMessage(Stringf("Profiler capture: %d zones written to %s", zoneCount, path.c_str()), 3.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+// One simulation step: integration plus the demo props' spin
+void Game::StepProps(float const gameDeltaSeconds) const
+{
+    PROFILE_SCOPE("Game::StepProps");
+
+    m_propPool->Integrate(gameDeltaSeconds);
+
+    // The demo props may have been destroyed from script
+    if (int const cube = m_propPool->GetDenseIndex(m_rotatingCubeHandle); cube >= 0)
+    {
+        m_propPool->m_orientations[cube].m_pitchDegrees += 30.f * gameDeltaSeconds;
+        m_propPool->m_orientations[cube].m_rollDegrees += 30.f * gameDeltaSeconds;
+    }
+
+    if (int const sphere = m_propPool->GetDenseIndex(m_spinningSphereHandle); sphere >= 0)
+    {
+        m_propPool->m_orientations[sphere].m_yawDegrees += 45.f * gameDeltaSeconds;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Game::IsFixedTimestep() const
+{
+    return m_frameSteps.m_stepSeconds > 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+float Game::GetRenderInterpolation() const
+{
+    return IsFixedTimestep() ? m_frameSteps.m_interpolation : 1.f;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -630,13 +925,60 @@ void Game::RenderAttractMode() const
 //----------------------------------------------------------------------------------------------------
 void Game::RenderEntities() const
 {
+    PROFILE_SCOPE("Game::RenderEntities");
+
     g_renderer->SetModelConstants(m_player->GetModelToWorldTransform());
     m_player->Render();
 
-    for (Prop* prop : m_props)
+    if (m_propRenderer->IsPipelined())
+    {
+        m_propRenderer->RenderCapturedFrame();
+    }
+    else
+    {
+        m_propRenderer->Render(*m_propPool, *m_propSpatialGrid, m_player->GetViewFrustum(), GetRenderInterpolation());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// In pipelined mode the props on screen are one update old, so the whole world pass uses the camera they were
+// captured with; otherwise a moving camera would visibly slide against them
+Camera const& Game::GetWorldRenderCamera() const
+{
+    if (m_propRenderer->IsPipelined() && m_propRenderer->GetRenderCamera() != nullptr)
     {
-        prop->Render();
+        return *m_propRenderer->GetRenderCamera();
     }
+
+    return *m_player->GetCamera();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Fixed simulation steps run this frame; always 1 without a fixed timestep. Script advances its frame count by
+// this, so frame-count timers measure simulated time.
+int Game::GetFrameStepCount() const
+{
+    return IsFixedTimestep() ? m_frameSteps.m_stepCount : 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::SetPipelinedRendering(bool const isPipelined)
+{
+    m_propRenderer->SetPipelined(isPipelined);
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(Game::SetPipelinedRendering)({})", isPipelined ? "on" : "off"));
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::RunStartupTestScript()
+{
+    ExecuteJavaScriptFile("Data/Scripts/test_scripts.js");
+}
+
+//----------------------------------------------------------------------------------------------------
+float Game::GetScriptStartupMs() const
+{
+    return m_scriptStartupMs;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -651,35 +993,33 @@ void Game::InitPlayer() const
 }
 
 //----------------------------------------------------------------------------------------------------
+// Spawn order fixes the handles (0 - 3) that the debug keys and scripts address
 void Game::SpawnProps()
 {
-    // Texture const* texture = g_renderer->CreateOrGetTextureFromFile("Data/Images/TestUV.png");
-    Texture const* texture = ResourceSubsystem::CreateOrGetTextureFromFile("Data/Images/TestUV.png");
-
-    m_props.reserve(4);
-
-    Prop* prop1 = new Prop(this);
-    Prop* prop2 = new Prop(this);
-    Prop* prop3 = new Prop(this, texture);
-    Prop* prop4 = new Prop(this);
-
-    if (prop1 != nullptr) m_props.push_back(prop1);
-    if (prop2 != nullptr) m_props.push_back(prop2);
-    if (prop3 != nullptr) m_props.push_back(prop3);
-    if (prop4 != nullptr) m_props.push_back(prop4);
+    m_propPool            = new PropPool();
+    m_propRenderer        = new PropRenderer();
+    m_propSpatialGrid     = new PropSpatialGrid();
+    m_propTextureStreamer = new PropTextureStreamer();
+
+    m_rotatingCubeHandle   = m_propPool->Spawn(ePropMesh::CUBE, Vec3::ZERO);
+    m_pulsingCubeHandle    = m_propPool->Spawn(ePropMesh::CUBE, Vec3::ZERO);
+    m_spinningSphereHandle = m_propPool->Spawn(ePropMesh::SPHERE, Vec3::ZERO);
+    m_gridHandle           = m_propPool->Spawn(ePropMesh::GRID, Vec3::ZERO);
+
+    // Untextured until the streamer has it; see PropTextureStreamer.hpp
+    m_propTextureStreamer->RequestTexture(*m_propPool, m_spinningSphereHandle, "Data/Images/TestUV.png");
 }
 
+//----------------------------------------------------------------------------------------------------
+// The sphere mesh is centered on the local origin, so (10, -5, 1) is where it draws. The old Prop path baked
+// m_position into the sphere's vertexes, but only while it was still zero, so its placement is unchanged.
+//
 void Game::InitProps() const
 {
-    m_props[0]->InitializeLocalVertsForCube();
-    m_props[1]->InitializeLocalVertsForCube();
-    m_props[2]->InitializeLocalVertsForSphere();
-    m_props[3]->InitializeLocalVertsForGrid();
-
-    m_props[0]->m_position = Vec3(2.f, 2.f, 0.f);
-    m_props[1]->m_position = Vec3(-2.f, -2.f, 0.f);
-    m_props[2]->m_position = Vec3(10, -5, 1);
-    m_props[3]->m_position = Vec3::ZERO;
+    m_propPool->m_positions[m_propPool->GetDenseIndex(m_rotatingCubeHandle)]   = Vec3(2.f, 2.f, 0.f);
+    m_propPool->m_positions[m_propPool->GetDenseIndex(m_pulsingCubeHandle)]    = Vec3(-2.f, -2.f, 0.f);
+    m_propPool->m_positions[m_propPool->GetDenseIndex(m_spinningSphereHandle)] = Vec3(10, -5, 1);
+    m_propPool->m_positions[m_propPool->GetDenseIndex(m_gridHandle)]           = Vec3::ZERO;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -723,6 +1063,23 @@ void Game::ExecuteJavaScriptCommand(String const& command)
     // DAEMON_LOG(LogGame, eLogVerbosity::Log, Stringf("Game::ExecuteJavaScriptCommand() end | %s", command.c_str()));
 }
 
+//----------------------------------------------------------------------------------------------------
+// Hot path for the per-frame JSEngine entry points: unlike ExecuteJavaScriptCommand, the (always undefined)
+// result is not copied out or logged, so a successful frame does no string work on the C++ side.
+//
+void Game::ExecuteJavaScriptFrameEntry(String const& entrySource) const
+{
+    if (g_scriptSubsystem->ExecuteScript(entrySource))
+    {
+        return;
+    }
+
+    if (g_scriptSubsystem->HasError())
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Error, Stringf("(Game::ExecuteJavaScriptFrameEntry)(failed)(error: %s)", g_scriptSubsystem->GetLastError().c_str()));
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::ExecuteJavaScriptCommandForDebug(String const& command, String const& scriptName)
 {
@@ -741,6 +1098,13 @@ void Game::ExecuteJavaScriptCommandForDebug(String const& command, String const&
         return;
     }
 
+    // Outside the debugging profile nothing is registered with the inspector
+    if (!g_app->IsScriptRegistryEnabled())
+    {
+        ExecuteJavaScriptCommand(command);
+        return;
+    }
+
     // Use the registered script execution method for Chrome DevTools debugging
     bool const success = g_scriptSubsystem->ExecuteRegisteredScript(command, scriptName);
 
@@ -782,9 +1146,15 @@ void Game::ExecuteJavaScriptFileForDebug(String const& filename)
         return;
     }
 
-    // Read the script file content
-    std::string   fullPath = filename;
-    std::ifstream file(fullPath);
+    // Outside the debugging profile nothing is registered with the inspector, and the ScriptSubsystem reads the file
+    if (!g_app->IsScriptRegistryEnabled())
+    {
+        ExecuteJavaScriptFile(filename);
+        return;
+    }
+
+    // Read the script file content in one read of its known size
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
 
     if (!file.is_open())
     {
@@ -792,9 +1162,9 @@ void Game::ExecuteJavaScriptFileForDebug(String const& filename)
         return;
     }
 
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    std::string scriptContent = buffer.str();
+    std::string scriptContent(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    file.read(scriptContent.data(), static_cast<std::streamsize>(scriptContent.size()));
     file.close();
 
     if (scriptContent.empty())
@@ -917,7 +1287,7 @@ void Game::HandleJavaScriptCommands()
 
     if (g_input->WasKeyJustPressed('L'))
     {
-        // ExecuteJavaScriptCommand("var pos = game.getPlayerPosition(); console.log('Player Position:', pos);");
+        // ExecuteJavaScriptCommand("console.log('Player Position:', game.playerPositionX, game.playerPositionY, game.playerPositionZ);");
         ExecuteJavaScriptCommand("debug('Player Position');");
         // ExecuteJavaScriptCommand("console.log('這是真的 JavaScript 輸出！'); 42;");
     }
@@ -936,37 +1306,60 @@ void Game::HandleJavaScriptCommands()
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::CreateCube(Vec3 const& position)
+PropHandle Game::CreateCube(Vec3 const& position)
 {
-    DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(Game::CreateCube)(start)(position ({:.2f}, {:.2f}, {:.2f}))", position.x, position.y, position.z));
-
-    Prop* newCube       = new Prop(this);
-    newCube->m_position = position;
-    newCube->m_color    = Rgba8(
-        static_cast<unsigned char>(g_rng->RollRandomIntInRange(100, 255)),
-        static_cast<unsigned char>(g_rng->RollRandomIntInRange(100, 255)),
-        static_cast<unsigned char>(g_rng->RollRandomIntInRange(100, 255)),
+    DEFERRED_LOG(LogScript, eLogVerbosity::Log, "(Game::CreateCube)(start)(position ({:.2f}, {:.2f}, {:.2f}))", position.x, position.y, position.z);
+
+    Rgba8 const color = Rgba8(
+        static_cast<unsigned char>(m_random.RollRandomIntInRange(100, 255)),
+        static_cast<unsigned char>(m_random.RollRandomIntInRange(100, 255)),
+        static_cast<unsigned char>(m_random.RollRandomIntInRange(100, 255)),
         255
     );
-    newCube->InitializeLocalVertsForCube();
 
-    m_props.push_back(newCube);
+    PropHandle const handle = SpawnCube(position, color);
 
-    DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(Game::CreateCube)(end)(m_props size: {})", m_props.size()));
+    DEFERRED_LOG(LogScript, eLogVerbosity::Log, "(Game::CreateCube)(end)(prop count: {})", m_propPool->GetCount());
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+PropHandle Game::SpawnCube(Vec3 const& position, Rgba8 const& color)
+{
+    PropHandle const handle = m_propPool->Spawn(ePropMesh::CUBE, position, color);
+
+    if (handle == INVALID_PROP_HANDLE)
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(Game::SpawnCube)(prop pool full at {} props, spawn dropped)", m_propPool->GetCount()));
+    }
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Game::DestroyProp(PropHandle const handle)
+{
+    return m_propPool->Destroy(handle);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Game::RequestPropTexture(PropHandle const handle, String const& path)
+{
+    return m_propTextureStreamer->RequestTexture(*m_propPool, handle, path);
 }
 
 //----------------------------------------------------------------------------------------------------
 void Game::MoveProp(int         propIndex,
                     Vec3 const& newPosition)
 {
-    if (propIndex >= 0 && propIndex < static_cast<int>(m_props.size()))
+    if (int const denseIndex = m_propPool->GetDenseIndex(propIndex); denseIndex >= 0)
     {
-        m_props[propIndex]->m_position = newPosition;
-        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(Game::MoveProp)(end)(prop {} move to position ({:.2f}, {:.2f}, {:.2f}))", propIndex, newPosition.x, newPosition.y, newPosition.z));
+        m_propPool->m_positions[denseIndex] = newPosition;
+        DEFERRED_LOG(LogScript, eLogVerbosity::Log, "(Game::MoveProp)(end)(prop {} move to position ({:.2f}, {:.2f}, {:.2f}))", propIndex, newPosition.x, newPosition.y, newPosition.z);
     }
     else
     {
-        DebuggerPrintf("警告：JavaScript 請求移動無效的物件索引 %d（總共 %zu 個物件）\n", propIndex, m_props.size());
+        DebuggerPrintf("警告：JavaScript 請求移動無效或已銷毀的物件索引 %d（總共 %d 個物件）\n", propIndex, m_propPool->GetCount());
     }
 }
 
@@ -976,10 +1369,67 @@ Player* Game::GetPlayer()
     return m_player;
 }
 
+//----------------------------------------------------------------------------------------------------
+int Game::GetPropCount() const
+{
+    return m_propPool->GetSlotCount();
+}
+
+//----------------------------------------------------------------------------------------------------
+int Game::GetLivePropCount() const
+{
+    return m_propPool->GetCount();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Positions as of the end of the last Game::Update
+int Game::QueryPropsInRadius(Vec3 const& center, float const radius)
+{
+    // IsOverlapping squares radius + propRadius, so a negative radius would still report nearby props
+    if (!std::isfinite(radius) || radius < 0.f || !std::isfinite(center.x) || !std::isfinite(center.y) || !std::isfinite(center.z))
+    {
+        DAEMON_LOG(LogScript, eLogVerbosity::Warning, StringFormat("(Game::QueryPropsInRadius)(rejected center ({}, {}, {}) radius {})", center.x, center.y, center.z, radius));
+        m_propQueryResults.clear();
+        return 0;
+    }
+
+    m_propSpatialGrid->QuerySphere(*m_propPool, center, radius, m_propQueryResults);
+
+    return static_cast<int>(m_propQueryResults.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+PropHandle Game::GetQueriedProp(int const resultIndex) const
+{
+    if (resultIndex < 0 || resultIndex >= static_cast<int>(m_propQueryResults.size()))
+    {
+        return INVALID_PROP_HANDLE;
+    }
+
+    return m_propQueryResults[resultIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+float Game::GetJSGameDeltaSeconds() const
+{
+    return m_jsGameDeltaSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+float Game::GetJSSystemDeltaSeconds() const
+{
+    return m_jsSystemDeltaSeconds;
+}
+
 void Game::Update(float const gameDeltaSeconds,
                   float const systemDeltaSeconds)
 {
+    ALLOCATION_TAG("Gameplay");
+
+    ApplyPropCommands();
+    m_propTextureStreamer->Update(*m_propPool);
     UpdateEntities(gameDeltaSeconds, systemDeltaSeconds);
+    m_propSpatialGrid->Update(*m_propPool);     // After every prop move this frame, so render and script queries agree
     UpdateFromKeyBoard();
     UpdateFromController();
 
@@ -990,43 +1440,28 @@ void Game::Update(float const gameDeltaSeconds,
 
 void Game::Render()
 {
+    ALLOCATION_TAG("Render");
+
     //-Start-of-Game-Camera---------------------------------------------------------------------------
 
-    g_renderer->BeginCamera(*m_player->GetCamera());
+    Camera const& worldCamera = GetWorldRenderCamera();
+
+    g_renderer->BeginCamera(worldCamera);
 
     if (m_gameState == eGameState::GAME)
     {
         RenderEntities();
-        Vec2 screenDimensions = Window::s_mainWindow->GetScreenDimensions();
-        Vec2 windowDimensions = Window::s_mainWindow->GetWindowDimensions();
-        Vec2 clientDimensions = Window::s_mainWindow->GetClientDimensions();
-        Vec2 windowPosition   = Window::s_mainWindow->GetWindowPosition();
-        Vec2 clientPosition   = Window::s_mainWindow->GetClientPosition();
-        DebugAddScreenText(Stringf("ScreenDimensions=(%.1f,%.1f)", screenDimensions.x, screenDimensions.y), Vec2(0, 0), 20.f, Vec2::ZERO, 0.f);
-        DebugAddScreenText(Stringf("WindowDimensions=(%.1f,%.1f)", windowDimensions.x, windowDimensions.y), Vec2(0, 20), 20.f, Vec2::ZERO, 0.f);
-        DebugAddScreenText(Stringf("ClientDimensions=(%.1f,%.1f)", clientDimensions.x, clientDimensions.y), Vec2(0, 40), 20.f, Vec2::ZERO, 0.f);
-        DebugAddScreenText(Stringf("WindowPosition=(%.1f,%.1f)", windowPosition.x, windowPosition.y), Vec2(0, 60), 20.f, Vec2::ZERO, 0.f);
-        DebugAddScreenText(Stringf("ClientPosition=(%.1f,%.1f)", clientPosition.x, clientPosition.y), Vec2(0, 80), 20.f, Vec2::ZERO, 0.f);
-
-        if (g_scriptSubsystem)
-        {
-            std::string jsStatus = g_scriptSubsystem->IsInitialized() ? "JS:Initialized" : "JS:UnInitialized";
-            DebugAddScreenText(jsStatus, Vec2(0, 100), 20.f, Vec2::ZERO, 0.f);
-
-            if (g_scriptSubsystem->HasError())
-            {
-                DebugAddScreenText("JS錯誤: " + g_scriptSubsystem->GetLastError(), Vec2(0, 120), 15.f, Vec2::ZERO, 0.f, Rgba8::RED);
-            }
-        }
+        ALLOCATION_TAG("DebugText");
+        UpdateWindowStatsText();
     }
 
-    g_renderer->EndCamera(*m_player->GetCamera());
+    g_renderer->EndCamera(worldCamera);
 
     //-End-of-Game-Camera-----------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
     if (m_gameState == eGameState::GAME)
     {
-        DebugRenderWorld(*m_player->GetCamera());
+        DebugRenderWorld(worldCamera);
     }
     //------------------------------------------------------------------------------------------------
     //-Start-of-Screen-Camera-------------------------------------------------------------------------
@@ -1038,6 +1473,11 @@ void Game::Render()
         RenderAttractMode();
     }
 
+    if (m_gameState == eGameState::GAME)
+    {
+        m_debugTextOverlay->Render();
+    }
+
     g_renderer->EndCamera(*m_screenCamera);
 
     //-End-of-Screen-Camera---------------------------------------------------------------------------
@@ -1066,6 +1506,125 @@ void Game::MovePlayerCamera(Vec3 const& offset)
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+void Game::SubmitPropCommands(float const* commands, int const commandCount)
+{
+    if (commands == nullptr || commandCount <= 0)
+    {
+        return;
+    }
+
+    m_pendingPropCommands.insert(m_pendingPropCommands.end(), commands, commands + commandCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Decodes the packed command stream (see PropCommand.hpp) in a single pass. A malformed command (an unknown or
+// fractional opcode, a truncated payload, a NaN or infinite payload value, or a handle that is not a whole number
+// in handle range) stops the pass, because once an opcode or payload is misread every value after it is
+// misaligned as well. Non-finite values are never stored: they would reach the render sort keys and the grid.
+//
+void Game::ApplyPropCommands()
+{
+    if (m_pendingPropCommands.empty())
+    {
+        return;
+    }
+
+    float const* const commands     = m_pendingPropCommands.data();
+    int const          commandCount = static_cast<int>(m_pendingPropCommands.size());
+
+    auto const toColorChannel = [](float const value)
+    {
+        return static_cast<unsigned char>(GetClamped(value, 0.f, 255.f));
+    };
+
+    auto const logMalformed = [commandCount](float const value, int const offset)
+    {
+        DAEMON_LOG(LogScript, eLogVerbosity::Warning, StringFormat("(Game::ApplyPropCommands)(malformed command {} at offset {}, dropped the remaining {} values)", value, offset, commandCount - offset));
+    };
+
+    int constexpr PROP_HANDLE_LIMIT = PROP_HANDLE_MAX_SLOTS * PROP_HANDLE_MAX_GENERATION;
+
+    int cursor = 0;
+
+    while (cursor < commandCount)
+    {
+        int opcode = 0;
+        if (!TryGetPropCommandInteger(commands[cursor], static_cast<int>(ePropCommand::COUNT), opcode))
+        {
+            logMalformed(commands[cursor], cursor);
+            break;
+        }
+
+        ePropCommand const command     = static_cast<ePropCommand>(opcode);
+        int const          payloadSize = GetPropCommandPayloadSize(command);
+
+        if (payloadSize < 0 || cursor + 1 + payloadSize > commandCount)
+        {
+            logMalformed(commands[cursor], cursor);
+            break;
+        }
+
+        float const* const payload = commands + cursor + 1;
+
+        if (!std::all_of(payload, payload + payloadSize, [](float const value) { return std::isfinite(value); }))
+        {
+            logMalformed(commands[cursor], cursor);
+            break;
+        }
+
+        if (command == ePropCommand::SPAWN)
+        {
+            cursor += 1 + payloadSize;
+            SpawnCube(Vec3(payload[0], payload[1], payload[2]),
+                      Rgba8(toColorChannel(payload[3]), toColorChannel(payload[4]), toColorChannel(payload[5]), toColorChannel(payload[6])));
+            continue;
+        }
+
+        PropHandle handle = INVALID_PROP_HANDLE;
+        if (!TryGetPropCommandInteger(payload[0], PROP_HANDLE_LIMIT, handle))
+        {
+            logMalformed(commands[cursor], cursor);
+            break;
+        }
+
+        cursor += 1 + payloadSize;
+
+        // Props spawned earlier in the same stream are addressable by the commands after them. A well-formed
+        // handle whose prop is gone (destroyed, or its slot reused) is skipped without ending the pass.
+        int const denseIndex = m_propPool->GetDenseIndex(handle);
+        if (denseIndex < 0)
+        {
+            continue;
+        }
+
+        switch (command)
+        {
+        case ePropCommand::MOVE:
+            m_propPool->m_positions[denseIndex] = Vec3(payload[1], payload[2], payload[3]);
+            break;
+
+        case ePropCommand::SET_COLOR:
+            m_propPool->m_colors[denseIndex] = Rgba8(toColorChannel(payload[1]), toColorChannel(payload[2]), toColorChannel(payload[3]), toColorChannel(payload[4]));
+            break;
+
+        case ePropCommand::SET_ANGULAR_VELOCITY:
+            m_propPool->m_angularVelocities[denseIndex] = EulerAngles(payload[1], payload[2], payload[3]);
+            break;
+
+        case ePropCommand::DESTROY:
+            // The slot is recycled under a new generation, so later commands with this handle are dropped
+            m_propPool->Destroy(handle);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    m_pendingPropCommands.clear();
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::HandleConsoleCommands()
 {
@@ -1116,7 +1675,13 @@ void Game::InitializeJavaScriptFramework()
 
         // Load ES6 module entry point (imports all other modules via import statements)
         DAEMON_LOG(LogGame, eLogVerbosity::Display, "Loading main.mjs (ES6 module entry point)...");
-        ExecuteModuleFile("Data/Scripts/main.mjs");
+        double const startSeconds = GetCurrentTimeSeconds();
+        {
+            PROFILE_SCOPE("Game::LoadMainModule");
+            ExecuteModuleFile("Data/Scripts/main.mjs");
+        }
+        m_scriptStartupMs = static_cast<float>((GetCurrentTimeSeconds() - startSeconds) * 1000.0);
+        DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::InitializeJavaScriptFramework)(main.mjs module graph loaded in {:.1f} ms)", m_scriptStartupMs));
 
         DAEMON_LOG(LogGame, eLogVerbosity::Display, "Game::InitializeJavaScriptFramework() complete - Pure ES6 Module architecture initialized");
     }
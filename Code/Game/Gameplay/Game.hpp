@@ -7,12 +7,18 @@
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Renderer/VertexUtils.hpp"
+#include "Game/Framework/FrameScheduler.hpp"
+#include "Game/Framework/SeededRandom.hpp"
+#include "Game/Gameplay/PropPool.hpp"
 
 //----------------------------------------------------------------------------------------------------
 class Camera;
 class Clock;
+class DebugTextOverlay;
 class Player;
-class Prop;
+class PropRenderer;
+class PropSpatialGrid;
+class PropTextureStreamer;
 
 //----------------------------------------------------------------------------------------------------
 enum class eGameState : uint8_t
@@ -29,7 +35,7 @@ public:
     ~Game();
 
     void PostInit();
-    void UpdateJS();
+    void UpdateJS(sFrameSteps const& frameSteps);
     void RenderJS();
 
     bool IsAttractMode() const;
@@ -49,12 +55,25 @@ public:
     // JavaScript callback functions
     eGameState GetGameState() const;
     void       SetGameState(eGameState newState);
-    void       CreateCube(Vec3 const& position);
+    PropHandle CreateCube(Vec3 const& position);
+    bool       DestroyProp(PropHandle handle);
+    bool       RequestPropTexture(PropHandle handle, String const& path);
     void       MoveProp(int propIndex, Vec3 const& newPosition);
     void       MovePlayerCamera(Vec3 const& offset);
+    void       SubmitPropCommands(float const* commands, int commandCount);
     Player*    GetPlayer();
+    int        GetPropCount() const;
+    int        GetLivePropCount() const;
+    int        QueryPropsInRadius(Vec3 const& center, float radius);
+    PropHandle GetQueriedProp(int resultIndex) const;
     void       Update(float gameDeltaSeconds, float systemDeltaSeconds);
     void       Render();
+    float      GetJSGameDeltaSeconds() const;
+    float      GetJSSystemDeltaSeconds() const;
+    int        GetFrameStepCount() const;
+    void       SetPipelinedRendering(bool isPipelined);
+    void       RunStartupTestScript();
+    float      GetScriptStartupMs() const;
 
 
     void HandleConsoleCommands();
@@ -63,24 +82,87 @@ private:
     void UpdateFromKeyBoard();
     void UpdateFromController();
     void UpdateEntities(float gameDeltaSeconds, float systemDeltaSeconds) const;
+    void StepProps(float gameDeltaSeconds) const;
+    bool IsFixedTimestep() const;
+    float GetRenderInterpolation() const;
     void RenderAttractMode() const;
     void RenderEntities() const;
+    void InitDebugTextOverlay();
+    void UpdateFrameStatsText() const;
+    void UpdateWindowStatsText() const;
+    void RenderProfilerOverlay() const;
+    void RenderAllocationOverlay() const;
+    void ToggleProfilerCapture() const;
+    Camera const& GetWorldRenderCamera() const;
 
     void SpawnPlayer();
     void InitPlayer() const;
     void SpawnProps();
     void InitProps() const;
+    PropHandle SpawnCube(Vec3 const& position, Rgba8 const& color);
+    void ApplyPropCommands();
 
 
     void SetupJavaScriptBindings();
     void InitializeJavaScriptFramework();
-
-    Camera*            m_screenCamera = nullptr;
-    Player*            m_player       = nullptr;
-    Clock*             m_gameClock    = nullptr;
-    std::vector<Prop*> m_props;
-    eGameState         m_gameState = eGameState::ATTRACT;
-
-    Vec3 m_originalPlayerPosition = Vec3(-2.f, 0.f, 1.f);
-    bool m_cameraShakeActive      = false;
+    void ExecuteJavaScriptFrameEntry(String const& entrySource) const;
+
+    Camera*              m_screenCamera        = nullptr;
+    Player*              m_player              = nullptr;
+    Clock*               m_gameClock           = nullptr;
+    PropPool*            m_propPool            = nullptr;
+    PropRenderer*        m_propRenderer        = nullptr;
+    PropSpatialGrid*     m_propSpatialGrid     = nullptr;
+    PropTextureStreamer* m_propTextureStreamer = nullptr;
+    DebugTextOverlay*    m_debugTextOverlay    = nullptr;
+    eGameState           m_gameState           = eGameState::ATTRACT;
+
+    // Demo props animated in UpdateEntities
+    PropHandle m_rotatingCubeHandle   = INVALID_PROP_HANDLE;
+    PropHandle m_pulsingCubeHandle    = INVALID_PROP_HANDLE;
+    PropHandle m_spinningSphereHandle = INVALID_PROP_HANDLE;
+    PropHandle m_gridHandle           = INVALID_PROP_HANDLE;
+
+    Vec3 m_originalPlayerPosition   = Vec3(-2.f, 0.f, 1.f);
+    bool m_cameraShakeActive        = false;
+    bool m_isProfilerOverlayVisible = false;     // F3; zone breakdown under the frame stats
+    bool m_isAllocationOverlayVisible = false;   // F5; last frame's heap allocations by tag
+
+    // Always-on stats lines in m_debugTextOverlay, top right (frame) and bottom left (window, script state)
+    struct sDebugTextLines
+    {
+        int m_gameTime         = -1;
+        int m_systemTime       = -1;
+        int m_fps              = -1;
+        int m_timeScale        = -1;
+        int m_props            = -1;
+        int m_frameCost        = -1;
+        int m_screenDimensions = -1;
+        int m_windowDimensions = -1;
+        int m_clientDimensions = -1;
+        int m_windowPosition   = -1;
+        int m_clientPosition   = -1;
+        int m_scriptStatus     = -1;
+        int m_scriptError      = -1;
+    };
+    sDebugTextLines m_debugTextLines;
+
+    // Wall time of parsing, compiling and evaluating the main.mjs module graph in InitializeJavaScriptFramework
+    float m_scriptStartupMs = 0.f;
+
+    // Frame deltas handed to JSEngine.update(); read back by script through game.gameDeltaSeconds / game.systemDeltaSeconds
+    float m_jsGameDeltaSeconds   = 0.f;
+    float m_jsSystemDeltaSeconds = 0.f;
+
+    // This frame's share of the fixed simulation timestep set by App's FrameScheduler (see FrameScheduler.hpp)
+    sFrameSteps m_frameSteps;
+
+    // Seeded from the ReplaySession, so a replay spawns the same cube colors
+    SeededRandom m_random;
+
+    // Packed ePropCommand stream from game.submitCommands(), applied in one pass at the start of Update()
+    std::vector<float> m_pendingPropCommands;
+
+    // Result of the last game.queryPropsInRadius(), read back one handle at a time through game.getQueriedProp()
+    std::vector<PropHandle> m_propQueryResults;
 };
@@ -6,6 +6,8 @@
 #include "Game/Gameplay/Player.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Game/Gameplay/Game.hpp"
+#include "Game/Gameplay/PropSpatialGrid.hpp"
+#include "Game/Framework/App.hpp"
 #include "Game/Framework/GameCommon.hpp"
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Core/EngineCommon.hpp"
@@ -19,7 +21,7 @@ Player::Player(Game* owner)
 {
     m_worldCamera = new Camera();
 
-    m_worldCamera->SetPerspectiveGraphicView(2.f, 60.f, 0.1f, 100.f);
+    m_worldCamera->SetPerspectiveGraphicView(m_cameraAspect, m_cameraFOVDegrees, m_cameraNearDistance, m_cameraFarDistance);
 
     m_worldCamera->SetNormalizedViewport(AABB2::ZERO_TO_ONE);
 
@@ -81,8 +83,10 @@ void Player::Update(float deltaSeconds)
     m_orientation.m_yawDegrees -= rightStickInput.x * 0.125f;
     m_orientation.m_pitchDegrees -= rightStickInput.y * 0.125f;
 
-    m_orientation.m_yawDegrees -= g_input->GetCursorClientDelta().x * 0.125f;
-    m_orientation.m_pitchDegrees += g_input->GetCursorClientDelta().y * 0.125f;
+    // Through the ReplaySession, which hands back the recorded delta during a replay
+    Vec2 const cursorDelta = g_app->GetReplaySession().GetCursorClientDelta();
+    m_orientation.m_yawDegrees -= cursorDelta.x * 0.125f;
+    m_orientation.m_pitchDegrees += cursorDelta.y * 0.125f;
     m_orientation.m_pitchDegrees = GetClamped(m_orientation.m_pitchDegrees, -85.f, 85.f);
 
     m_angularVelocity.m_rollDegrees = 0.f;
@@ -129,3 +133,14 @@ Camera* Player::GetCamera() const
 {
     return m_worldCamera;
 }
+
+//----------------------------------------------------------------------------------------------------
+sViewFrustum Player::GetViewFrustum() const
+{
+    return sViewFrustum::MakePerspective(m_worldCamera->GetPosition(),
+                                         m_worldCamera->GetOrientation(),
+                                         m_cameraAspect,
+                                         m_cameraFOVDegrees,
+                                         m_cameraNearDistance,
+                                         m_cameraFarDistance);
+}
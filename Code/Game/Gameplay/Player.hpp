@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------------------------------
 class Camera;
+struct sViewFrustum;
 
 //----------------------------------------------------------------------------------------------------
 class Player : public Entity
@@ -22,8 +23,14 @@ public:
     void UpdateFromKeyBoard();
     void UpdateFromController();
 
-    Camera* GetCamera() const;
+    Camera*      GetCamera() const;
+    sViewFrustum GetViewFrustum() const;
 
 private:
     Camera* m_worldCamera = nullptr;
+
+    float m_cameraAspect       = 2.f;
+    float m_cameraFOVDegrees   = 60.f;
+    float m_cameraNearDistance = 0.1f;
+    float m_cameraFarDistance  = 100.f;
 };
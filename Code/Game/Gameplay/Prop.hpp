@@ -1,32 +0,0 @@
-//----------------------------------------------------------------------------------------------------
-// Prop.hpp
-//----------------------------------------------------------------------------------------------------
-
-//----------------------------------------------------------------------------------------------------
-#pragma once
-//----------------------------------------------------------------------------------------------------
-#include "Game/Gameplay/Entity.hpp"
-//----------------------------------------------------------------------------------------------------
-#include "Engine/Renderer/VertexUtils.hpp"
-
-//-Forward-Declaration--------------------------------------------------------------------------------
-class Texture;
-struct Vertex_PCU;
-
-//----------------------------------------------------------------------------------------------------
-class Prop : public Entity
-{
-public:
-    explicit Prop(Game* owner, Texture const* texture = nullptr);
-
-    void Update(float deltaSeconds) override;
-    void Render() const override;
-
-    void InitializeLocalVertsForCube();
-    void InitializeLocalVertsForSphere();
-    void InitializeLocalVertsForGrid();
-
-private:
-    std::vector<Vertex_PCU> m_vertexes;
-    Texture const*          m_texture = nullptr;
-};
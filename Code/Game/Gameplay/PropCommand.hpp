@@ -0,0 +1,46 @@
+//----------------------------------------------------------------------------------------------------
+// PropCommand.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// Opcodes for the packed prop command buffer submitted from JavaScript through game.submitCommands().
+// The buffer is a flat run of floats: [opcode, payload..., opcode, payload..., ...]
+//
+//   MOVE                  propIndex, x, y, z
+//   SET_COLOR             propIndex, r, g, b, a          (0 - 255)
+//   SET_ANGULAR_VELOCITY  propIndex, yaw, pitch, roll    (degrees per second)
+//   SPAWN                 x, y, z, r, g, b, a            (spawns a cube)
+//   DESTROY               propIndex
+//
+// Indices travel as floats, which is exact up to 2^24, far above any prop count we reach.
+// Keep the values in sync with PROP_COMMAND in Data/Scripts/core/PropCommandBuffer.js.
+//
+enum class ePropCommand : uint8_t
+{
+    MOVE                 = 0,
+    SET_COLOR            = 1,
+    SET_ANGULAR_VELOCITY = 2,
+    SPAWN                = 3,
+    DESTROY              = 4,
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+// Number of floats following the opcode, or -1 for an unknown opcode
+constexpr int GetPropCommandPayloadSize(ePropCommand const command)
+{
+    switch (command)
+    {
+    case ePropCommand::MOVE:                 return 4;
+    case ePropCommand::SET_COLOR:            return 5;
+    case ePropCommand::SET_ANGULAR_VELOCITY: return 4;
+    case ePropCommand::SPAWN:                return 7;
+    case ePropCommand::DESTROY:              return 1;
+    default:                                 return -1;
+    }
+}
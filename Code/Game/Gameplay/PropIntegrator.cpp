@@ -0,0 +1,179 @@
+//----------------------------------------------------------------------------------------------------
+// PropIntegrator.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/PropIntegrator.hpp"
+
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+#include <chrono>
+#include <vector>
+
+#if !defined(GAME_DISABLE_SIMD)
+#if defined(__AVX__)
+#define GAME_PROP_INTEGRATOR_AVX
+#include <immintrin.h>
+#elif defined(_M_X64) || defined(__SSE2__)
+#define GAME_PROP_INTEGRATOR_SSE
+#include <emmintrin.h>
+#endif
+#endif
+
+static_assert(sizeof(Vec3) == 3 * sizeof(float), "IntegrateVec3s treats Vec3 arrays as packed floats");
+static_assert(sizeof(EulerAngles) == 3 * sizeof(float), "IntegrateEulerAngles treats EulerAngles arrays as packed floats");
+
+//----------------------------------------------------------------------------------------------------
+void IntegrateFloatsScalar(float* values, float const* rates, int const floatCount, float const deltaSeconds)
+{
+    for (int i = 0; i < floatCount; ++i)
+    {
+        values[i] += rates[i] * deltaSeconds;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void IntegrateFloats(float* values, float const* rates, int const floatCount, float const deltaSeconds)
+{
+    int i = 0;
+
+#if defined(GAME_PROP_INTEGRATOR_AVX)
+    __m256 const deltaSeconds8 = _mm256_set1_ps(deltaSeconds);
+
+    for (; i + 8 <= floatCount; i += 8)
+    {
+        __m256 const value = _mm256_loadu_ps(values + i);
+        __m256 const rate  = _mm256_loadu_ps(rates + i);
+        _mm256_storeu_ps(values + i, _mm256_add_ps(value, _mm256_mul_ps(rate, deltaSeconds8)));
+    }
+#elif defined(GAME_PROP_INTEGRATOR_SSE)
+    __m128 const deltaSeconds4 = _mm_set1_ps(deltaSeconds);
+
+    for (; i + 4 <= floatCount; i += 4)
+    {
+        __m128 const value = _mm_loadu_ps(values + i);
+        __m128 const rate  = _mm_loadu_ps(rates + i);
+        _mm_storeu_ps(values + i, _mm_add_ps(value, _mm_mul_ps(rate, deltaSeconds4)));
+    }
+#endif
+
+    // Tail (and the whole run when no SIMD path is compiled in)
+    IntegrateFloatsScalar(values + i, rates + i, floatCount - i, deltaSeconds);
+}
+
+//----------------------------------------------------------------------------------------------------
+void IntegrateEulerAngles(EulerAngles* orientations, EulerAngles const* angularVelocities, int const count, float const deltaSeconds)
+{
+    IntegrateFloats(&orientations->m_yawDegrees, &angularVelocities->m_yawDegrees, count * 3, deltaSeconds);
+}
+
+//----------------------------------------------------------------------------------------------------
+void IntegrateVec3s(Vec3* positions, Vec3 const* velocities, int const count, float const deltaSeconds)
+{
+    IntegrateFloats(&positions->x, &velocities->x, count * 3, deltaSeconds);
+}
+
+//----------------------------------------------------------------------------------------------------
+void BuildModelToWorldTransforms(Vec3 const* positions, EulerAngles const* orientations, int const count, Mat44* out_transforms)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        EulerAngles const& orientation = orientations[i];
+        Vec3 const&        position    = positions[i];
+
+        float const cy = CosDegrees(orientation.m_yawDegrees);
+        float const sy = SinDegrees(orientation.m_yawDegrees);
+        float const cp = CosDegrees(orientation.m_pitchDegrees);
+        float const sp = SinDegrees(orientation.m_pitchDegrees);
+        float const cr = CosDegrees(orientation.m_rollDegrees);
+        float const sr = SinDegrees(orientation.m_rollDegrees);
+
+        float* m = out_transforms[i].m_values;
+
+        m[Mat44::Ix] = cy * cp;
+        m[Mat44::Iy] = sy * cp;
+        m[Mat44::Iz] = -sp;
+        m[Mat44::Iw] = 0.f;
+
+        m[Mat44::Jx] = -sy * cr + cy * sp * sr;
+        m[Mat44::Jy] = cy * cr + sy * sp * sr;
+        m[Mat44::Jz] = cp * sr;
+        m[Mat44::Jw] = 0.f;
+
+        m[Mat44::Kx] = sy * sr + cy * sp * cr;
+        m[Mat44::Ky] = -cy * sr + sy * sp * cr;
+        m[Mat44::Kz] = cp * cr;
+        m[Mat44::Kw] = 0.f;
+
+        m[Mat44::Tx] = position.x;
+        m[Mat44::Ty] = position.y;
+        m[Mat44::Tz] = position.z;
+        m[Mat44::Tw] = 1.f;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+String RunPropIntegratorBenchmark()
+{
+    using BenchmarkClock = std::chrono::steady_clock;
+
+    int constexpr propCounts[] = {1000, 10000, 100000};
+    int constexpr iterations   = 100;
+    float const   deltaSeconds = 1.f / 60.f;
+
+#if defined(GAME_PROP_INTEGRATOR_AVX)
+    char const* simdName = "AVX";
+#elif defined(GAME_PROP_INTEGRATOR_SSE)
+    char const* simdName = "SSE2";
+#else
+    char const* simdName = "scalar";
+#endif
+
+    auto const microsecondsPerPass = [](BenchmarkClock::duration const elapsed)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / 1000.0 / iterations;
+    };
+
+    String report = Stringf("(PropIntegrator benchmark)(SIMD path: %s)(%d passes each)", simdName, iterations);
+    float  checksum = 0.f;
+
+    for (int const propCount : propCounts)
+    {
+        std::vector<EulerAngles> orientations(propCount);
+        std::vector<EulerAngles> angularVelocities(propCount, EulerAngles(45.f, 30.f, 15.f));
+        std::vector<Vec3>        positions(propCount);
+        std::vector<Mat44>       transforms(propCount);
+
+        BenchmarkClock::time_point const scalarStart = BenchmarkClock::now();
+        for (int pass = 0; pass < iterations; ++pass)
+        {
+            IntegrateFloatsScalar(&orientations[0].m_yawDegrees, &angularVelocities[0].m_yawDegrees, propCount * 3, deltaSeconds);
+        }
+        BenchmarkClock::time_point const simdStart = BenchmarkClock::now();
+        for (int pass = 0; pass < iterations; ++pass)
+        {
+            IntegrateEulerAngles(orientations.data(), angularVelocities.data(), propCount, deltaSeconds);
+        }
+        BenchmarkClock::time_point const matrixStart = BenchmarkClock::now();
+        for (int pass = 0; pass < iterations; ++pass)
+        {
+            BuildModelToWorldTransforms(positions.data(), orientations.data(), propCount, transforms.data());
+        }
+        BenchmarkClock::time_point const matrixEnd = BenchmarkClock::now();
+
+        checksum += orientations[propCount - 1].m_yawDegrees + transforms[propCount - 1].m_values[Mat44::Ix];
+
+        report += Stringf("\n  %6d props: scalar %.1f us | %s %.1f us | Mat44 build %.1f us",
+                          propCount,
+                          microsecondsPerPass(simdStart - scalarStart),
+                          simdName,
+                          microsecondsPerPass(matrixStart - simdStart),
+                          microsecondsPerPass(matrixEnd - matrixStart));
+    }
+
+    report += Stringf("\n  (checksum %.3f)", checksum);
+    return report;
+}
@@ -0,0 +1,34 @@
+//----------------------------------------------------------------------------------------------------
+// PropIntegrator.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+struct EulerAngles;
+struct Mat44;
+struct Vec3;
+
+//----------------------------------------------------------------------------------------------------
+// Batch integrators over PropPool's dense component arrays.
+//
+// Vec3 and EulerAngles are three packed floats, so a run of N of them is a flat run of 3N floats and
+// `value += rate * deltaSeconds` vectorizes across prop boundaries without any shuffling. The SIMD path
+// is picked at compile time (AVX when the compiler targets it, SSE2 on every x64 build) and falls back to
+// the scalar loop elsewhere or when GAME_DISABLE_SIMD is defined.
+//
+void IntegrateFloats(float* values, float const* rates, int floatCount, float deltaSeconds);
+void IntegrateFloatsScalar(float* values, float const* rates, int floatCount, float deltaSeconds);
+
+void IntegrateEulerAngles(EulerAngles* orientations, EulerAngles const* angularVelocities, int count, float deltaSeconds);
+void IntegrateVec3s(Vec3* positions, Vec3 const* velocities, int count, float deltaSeconds);
+
+// Same result as Mat44::SetTranslation3D + Append(EulerAngles::GetAsMatrix_IFwd_JLeft_KUp()), written straight
+// into a contiguous output array without the intermediate matrix multiply
+void BuildModelToWorldTransforms(Vec3 const* positions, EulerAngles const* orientations, int count, Mat44* out_transforms);
+
+// Times the scalar and SIMD integrators and the bulk matrix build at 1k / 10k / 100k props
+String RunPropIntegratorBenchmark();
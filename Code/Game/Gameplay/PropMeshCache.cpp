@@ -0,0 +1,200 @@
+//----------------------------------------------------------------------------------------------------
+// PropMeshCache.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/PropMeshCache.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/GeometryTables.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------
+static void AddVertsForPropCube(VertexList_PCU& verts)
+{
+    Vec3 const frontBottomLeft(0.5f, -0.5f, -0.5f);
+    Vec3 const frontBottomRight(0.5f, 0.5f, -0.5f);
+    Vec3 const frontTopLeft(0.5f, -0.5f, 0.5f);
+    Vec3 const frontTopRight(0.5f, 0.5f, 0.5f);
+    Vec3 const backBottomLeft(-0.5f, 0.5f, -0.5f);
+    Vec3 const backBottomRight(-0.5f, -0.5f, -0.5f);
+    Vec3 const backTopLeft(-0.5f, 0.5f, 0.5f);
+    Vec3 const backTopRight(-0.5f, -0.5f, 0.5f);
+
+    AddVertsForQuad3D(verts, frontBottomLeft, frontBottomRight, frontTopLeft, frontTopRight, Rgba8::RED);          // +X Red
+    AddVertsForQuad3D(verts, backBottomLeft, backBottomRight, backTopLeft, backTopRight, Rgba8::CYAN);             // -X -Red (Cyan)
+    AddVertsForQuad3D(verts, frontBottomRight, backBottomLeft, frontTopRight, backTopLeft, Rgba8::GREEN);          // -Y -Green (Magenta)
+    AddVertsForQuad3D(verts, backBottomRight, frontBottomLeft, backTopRight, frontTopLeft, Rgba8::MAGENTA);        // +Y Green
+    AddVertsForQuad3D(verts, frontTopLeft, frontTopRight, backTopRight, backTopLeft, Rgba8::BLUE);                 // +Z Blue
+    AddVertsForQuad3D(verts, backBottomRight, backBottomLeft, frontBottomLeft, frontBottomRight, Rgba8::YELLOW);   // -Z -Blue (Yellow)
+}
+
+//----------------------------------------------------------------------------------------------------
+// One quad per lattice cell, wound counter-clockwise seen from outside; the pole cells degenerate to triangles
+template <int NUM_SLICES, int NUM_STACKS>
+static void AddVertsForSphereLattice(VertexList_PCU& verts, float const radius, Rgba8 const& color)
+{
+    using Lattice = sUnitSphereLattice<NUM_SLICES, NUM_STACKS>;
+
+    Lattice const& lattice = UNIT_SPHERE_LATTICE<NUM_SLICES, NUM_STACKS>;
+    auto const     point   = [&](int const index) { return Vec3(lattice.m_x[index] * radius, lattice.m_y[index] * radius, lattice.m_z[index] * radius); };
+
+    verts.reserve(verts.size() + static_cast<size_t>(6 * NUM_SLICES * NUM_STACKS));
+
+    for (int stack = 0; stack < NUM_STACKS; ++stack)
+    {
+        for (int slice = 0; slice < NUM_SLICES; ++slice)
+        {
+            int const bottomLeft = Lattice::GetIndex(slice, stack);
+            int const topRight   = Lattice::GetIndex(slice + 1, stack + 1);
+
+            AddVertsForQuad3D(verts,
+                              point(bottomLeft),
+                              point(Lattice::GetIndex(slice + 1, stack)),
+                              point(Lattice::GetIndex(slice, stack + 1)),
+                              point(topRight),
+                              color,
+                              AABB2(Vec2(lattice.m_u[bottomLeft], lattice.m_v[bottomLeft]), Vec2(lattice.m_u[topRight], lattice.m_v[topRight])));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+static void AddVertsForPropSphere(VertexList_PCU& verts, int const numSlices, int const numStacks)
+{
+    float constexpr radius = 0.5f;
+    Rgba8 const     color  = Rgba8::WHITE;
+    AABB2 const     UVs    = AABB2::ZERO_TO_ONE;
+
+    // The default tessellation comes from the compile-time lattice; anything else is rare enough to build with trig
+    if (numSlices == 32 && numStacks == 16)
+    {
+        AddVertsForSphereLattice<32, 16>(verts, radius, color);
+        return;
+    }
+
+    AddVertsForSphere3D(verts, Vec3::ZERO, radius, color, UVs, numSlices, numStacks);
+}
+
+//----------------------------------------------------------------------------------------------------
+// A single 100x100 quad (6 vertexes). It is not doubled for the back face: the mesh is drawn with SOLID_CULL_NONE
+// so it is visible from below too. Grid.hlsl draws the lines.
+static void AddVertsForPropGrid(VertexList_PCU& verts)
+{
+    float constexpr halfExtent = 50.f;
+
+    Vec3 const minXMinY(-halfExtent, -halfExtent, 0.f);
+    Vec3 const minXMaxY(-halfExtent, halfExtent, 0.f);
+    Vec3 const maxXMinY(halfExtent, -halfExtent, 0.f);
+    Vec3 const maxXMaxY(halfExtent, halfExtent, 0.f);
+
+    AddVertsForQuad3D(verts, maxXMinY, maxXMaxY, minXMinY, minXMaxY);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool sPropMeshDesc::operator==(sPropMeshDesc const& other) const
+{
+    if (m_shape != other.m_shape)
+    {
+        return false;
+    }
+
+    // Tessellation only changes the geometry of spheres
+    return m_shape != ePropMesh::SPHERE || (m_slices == other.m_slices && m_stacks == other.m_stacks);
+}
+
+//----------------------------------------------------------------------------------------------------
+PropMeshCache::~PropMeshCache()
+{
+    for (sPropMesh& mesh : m_meshes)
+    {
+        GAME_SAFE_RELEASE(mesh.m_vertexBuffer);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// A handful of distinct meshes exist at most, so a linear search beats hashing the desc
+PropMeshID PropMeshCache::GetOrCreateMesh(sPropMeshDesc const& desc)
+{
+    for (int meshID = 0; meshID < static_cast<int>(m_meshes.size()); ++meshID)
+    {
+        if (m_meshes[meshID].m_desc == desc)
+        {
+            return meshID;
+        }
+    }
+
+    sPropMesh& mesh = m_meshes.emplace_back();
+    mesh.m_desc     = desc;
+
+    char const* shaderName = "Data/Shaders/Bloom";
+
+    switch (desc.m_shape)
+    {
+    case ePropMesh::CUBE:   AddVertsForPropCube(mesh.m_verts); break;
+    case ePropMesh::SPHERE: AddVertsForPropSphere(mesh.m_verts, desc.m_slices, desc.m_stacks); break;
+    case ePropMesh::GRID:
+        AddVertsForPropGrid(mesh.m_verts);
+        shaderName                          = "Data/Shaders/Grid";
+        mesh.m_renderState.m_rasterizerMode = eRasterizerMode::SOLID_CULL_NONE;
+        break;
+    default:                ERROR_AND_DIE("PropMeshCache::GetOrCreateMesh: unknown prop mesh shape")
+    }
+
+    mesh.m_shader = g_renderer->CreateOrGetShaderFromFile(shaderName, eVertexType::VERTEX_PCU);
+
+    float boundingRadiusSquared = 0.f;
+    for (Vertex_PCU const& vert : mesh.m_verts)
+    {
+        boundingRadiusSquared = std::max(boundingRadiusSquared, vert.m_position.GetLengthSquared());
+    }
+    mesh.m_boundingRadius = std::sqrt(boundingRadiusSquared);
+
+    unsigned int const stride = sizeof(Vertex_PCU);
+    unsigned int const size   = static_cast<unsigned int>(mesh.m_verts.size()) * stride;
+
+    mesh.m_vertexBuffer = g_renderer->CreateVertexBuffer(size, stride);
+    g_renderer->CopyCPUToGPU(mesh.m_verts.data(), size, mesh.m_vertexBuffer);
+
+    return static_cast<PropMeshID>(m_meshes.size()) - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+VertexList_PCU const& PropMeshCache::GetVerts(PropMeshID const meshID) const
+{
+    return m_meshes[meshID].m_verts;
+}
+
+//----------------------------------------------------------------------------------------------------
+VertexBuffer const* PropMeshCache::GetVertexBuffer(PropMeshID const meshID) const
+{
+    return m_meshes[meshID].m_vertexBuffer;
+}
+
+//----------------------------------------------------------------------------------------------------
+Shader const* PropMeshCache::GetShader(PropMeshID const meshID) const
+{
+    return m_meshes[meshID].m_shader;
+}
+
+//----------------------------------------------------------------------------------------------------
+sPropRenderState const& PropMeshCache::GetRenderState(PropMeshID const meshID) const
+{
+    return m_meshes[meshID].m_renderState;
+}
+
+//----------------------------------------------------------------------------------------------------
+float PropMeshCache::GetBoundingRadius(PropMeshID const meshID) const
+{
+    return m_meshes[meshID].m_boundingRadius;
+}
+
+//----------------------------------------------------------------------------------------------------
+int PropMeshCache::GetMeshCount() const
+{
+    return static_cast<int>(m_meshes.size());
+}
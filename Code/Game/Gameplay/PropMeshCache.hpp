@@ -0,0 +1,87 @@
+//----------------------------------------------------------------------------------------------------
+// PropMeshCache.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+
+#include <cstdint>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Shader;
+class VertexBuffer;
+
+//----------------------------------------------------------------------------------------------------
+enum class ePropMesh : uint8_t
+{
+    CUBE,
+    SPHERE,
+    GRID,
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+// Shape plus the parameters its geometry depends on; two descs that compare equal share one mesh
+struct sPropMeshDesc
+{
+    ePropMesh m_shape  = ePropMesh::CUBE;
+    int       m_slices = 32;     // SPHERE only
+    int       m_stacks = 16;     // SPHERE only
+
+    bool operator==(sPropMeshDesc const& other) const;
+};
+
+using PropMeshID = int;
+
+//----------------------------------------------------------------------------------------------------
+// Pipeline state a mesh is drawn with; PropRenderer sorts groups by it and only sets what changes
+struct sPropRenderState
+{
+    eBlendMode      m_blendMode      = eBlendMode::OPAQUE;
+    eDepthMode      m_depthMode      = eDepthMode::READ_WRITE_LESS_EQUAL;
+    eRasterizerMode m_rasterizerMode = eRasterizerMode::SOLID_CULL_BACK;
+    eSamplerMode    m_samplerMode    = eSamplerMode::POINT_CLAMP;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Builds each distinct prop mesh once, in local space, and uploads it to an immutable GPU vertex buffer.
+// Props keep only a PropMeshID. The CPU copy stays for PropRenderer's batched path, which bakes transforms
+// into one vertex list per group; props drawn on their own use the static vertex buffer and upload nothing.
+//
+// Each mesh also resolves the shader and render state it is drawn with, once, when it is built. The grid is a
+// single quad drawn without culling whose lines are computed in Data/Shaders/Grid.hlsl, so static scenery
+// costs one small draw with no per-line geometry.
+//
+class PropMeshCache
+{
+public:
+    PropMeshCache() = default;
+    ~PropMeshCache();
+
+    PropMeshCache(PropMeshCache const&)            = delete;
+    PropMeshCache& operator=(PropMeshCache const&) = delete;
+
+    PropMeshID              GetOrCreateMesh(sPropMeshDesc const& desc);
+    VertexList_PCU const&   GetVerts(PropMeshID meshID) const;
+    VertexBuffer const*     GetVertexBuffer(PropMeshID meshID) const;
+    Shader const*           GetShader(PropMeshID meshID) const;
+    sPropRenderState const& GetRenderState(PropMeshID meshID) const;
+    float                   GetBoundingRadius(PropMeshID meshID) const;     // Around the local origin
+    int                     GetMeshCount() const;
+
+private:
+    struct sPropMesh
+    {
+        sPropMeshDesc    m_desc;
+        VertexList_PCU   m_verts;
+        VertexBuffer*    m_vertexBuffer = nullptr;
+        Shader const*    m_shader       = nullptr;     // Owned by the renderer's shader cache
+        sPropRenderState m_renderState;
+        float            m_boundingRadius = 0.f;
+    };
+
+    std::vector<sPropMesh> m_meshes;
+};
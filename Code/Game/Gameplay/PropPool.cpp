@@ -0,0 +1,263 @@
+//----------------------------------------------------------------------------------------------------
+// PropPool.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/PropPool.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Game/Framework/ParallelFor.hpp"
+#include "Game/Gameplay/PropIntegrator.hpp"
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+// Props per ParallelFor chunk; integration is a few flops per prop, the matrix build a few dozen
+int constexpr INTEGRATE_CHUNK_SIZE = 8192;
+int constexpr TRANSFORM_CHUNK_SIZE = 2048;
+
+//----------------------------------------------------------------------------------------------------
+PropHandle PropPool::Spawn(ePropMesh const mesh,
+                           Vec3 const&     position,
+                           Rgba8 const&    color,
+                           Texture const*  texture)
+{
+    sPropMeshDesc meshDesc;
+    meshDesc.m_shape = mesh;
+
+    return Spawn(meshDesc, position, color, texture);
+}
+
+//----------------------------------------------------------------------------------------------------
+PropHandle PropPool::Spawn(sPropMeshDesc const& meshDesc,
+                           Vec3 const&          position,
+                           Rgba8 const&         color,
+                           Texture const*       texture)
+{
+    int slot;
+
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.front();
+        m_freeSlots.pop_front();
+    }
+    else if (GetSlotCount() < PROP_HANDLE_MAX_SLOTS)
+    {
+        slot = GetSlotCount();
+        m_denseIndexBySlot.push_back(-1);
+        m_generationBySlot.push_back(0);
+    }
+    else
+    {
+        return INVALID_PROP_HANDLE;
+    }
+
+    PropHandle const handle     = m_generationBySlot[slot] << PROP_HANDLE_SLOT_BITS | slot;
+    int const        denseIndex = GetCount();
+
+    m_positions.push_back(position);
+    m_velocities.push_back(Vec3::ZERO);
+    m_orientations.push_back(EulerAngles::ZERO);
+    m_angularVelocities.push_back(EulerAngles::ZERO);
+    m_colors.push_back(color);
+    m_meshIDs.push_back(m_meshCache.GetOrCreateMesh(meshDesc));
+    m_textures.push_back(texture);
+    m_modelToWorlds.emplace_back();
+    m_previousPositions.push_back(position);
+    m_previousOrientations.push_back(EulerAngles::ZERO);
+
+    m_handleByDenseIndex.push_back(handle);
+    m_denseIndexBySlot[slot] = denseIndex;
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Swap-and-pop: the last prop moves into the freed dense index and its slot is re-pointed there. The freed slot
+// gets a new generation, so the destroyed handle stops resolving before the slot is handed out again.
+bool PropPool::Destroy(PropHandle const handle)
+{
+    int const denseIndex = GetDenseIndex(handle);
+    if (denseIndex < 0)
+    {
+        return false;
+    }
+
+    int const lastIndex = GetCount() - 1;
+
+    if (denseIndex != lastIndex)
+    {
+        m_positions[denseIndex]            = m_positions[lastIndex];
+        m_velocities[denseIndex]           = m_velocities[lastIndex];
+        m_orientations[denseIndex]         = m_orientations[lastIndex];
+        m_angularVelocities[denseIndex]    = m_angularVelocities[lastIndex];
+        m_colors[denseIndex]               = m_colors[lastIndex];
+        m_meshIDs[denseIndex]              = m_meshIDs[lastIndex];
+        m_textures[denseIndex]             = m_textures[lastIndex];
+        m_modelToWorlds[denseIndex]        = m_modelToWorlds[lastIndex];
+        m_previousPositions[denseIndex]    = m_previousPositions[lastIndex];
+        m_previousOrientations[denseIndex] = m_previousOrientations[lastIndex];
+
+        PropHandle const movedHandle             = m_handleByDenseIndex[lastIndex];
+        m_handleByDenseIndex[denseIndex]         = movedHandle;
+        m_denseIndexBySlot[GetSlot(movedHandle)] = denseIndex;
+    }
+
+    m_positions.pop_back();
+    m_velocities.pop_back();
+    m_orientations.pop_back();
+    m_angularVelocities.pop_back();
+    m_colors.pop_back();
+    m_meshIDs.pop_back();
+    m_textures.pop_back();
+    m_modelToWorlds.pop_back();
+    m_previousPositions.pop_back();
+    m_previousOrientations.pop_back();
+    m_handleByDenseIndex.pop_back();
+
+    int const slot           = GetSlot(handle);
+    m_denseIndexBySlot[slot] = -1;
+    m_generationBySlot[slot] = (m_generationBySlot[slot] + 1) % PROP_HANDLE_MAX_GENERATION;
+    m_freeSlots.push_back(slot);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool PropPool::IsAlive(PropHandle const handle) const
+{
+    return GetDenseIndex(handle) >= 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+// -1 for destroyed props and for stale handles whose slot has been reused since
+int PropPool::GetDenseIndex(PropHandle const handle) const
+{
+    if (handle < 0 || GetSlot(handle) >= GetSlotCount())
+    {
+        return -1;
+    }
+
+    int const denseIndex = m_denseIndexBySlot[GetSlot(handle)];
+    if (denseIndex < 0 || m_handleByDenseIndex[denseIndex] != handle)
+    {
+        return -1;
+    }
+
+    return denseIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+PropHandle PropPool::GetHandle(int const denseIndex) const
+{
+    GUARANTEE_OR_DIE(denseIndex >= 0 && denseIndex < GetCount(), "PropPool::GetHandle: dense index out of range")
+
+    return m_handleByDenseIndex[denseIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+PropHandle PropPool::GetHandleForSlot(int const slot) const
+{
+    if (slot < 0 || slot >= GetSlotCount() || m_denseIndexBySlot[slot] < 0)
+    {
+        return INVALID_PROP_HANDLE;
+    }
+
+    return m_handleByDenseIndex[m_denseIndexBySlot[slot]];
+}
+
+//----------------------------------------------------------------------------------------------------
+int PropPool::GetCount() const
+{
+    return static_cast<int>(m_positions.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+// Slots ever allocated, free ones included; this is the peak live prop count, not the number of spawns
+int PropPool::GetSlotCount() const
+{
+    return static_cast<int>(m_denseIndexBySlot.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+int PropPool::GetSlot(PropHandle const handle)
+{
+    return handle & (PROP_HANDLE_MAX_SLOTS - 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropPool::Integrate(float const deltaSeconds)
+{
+    int const count = GetCount();
+    if (count == 0)
+    {
+        return;
+    }
+
+    ParallelFor(count, INTEGRATE_CHUNK_SIZE, [this, deltaSeconds](int const begin, int const end)
+    {
+        IntegrateEulerAngles(m_orientations.data() + begin, m_angularVelocities.data() + begin, end - begin, deltaSeconds);
+        IntegrateVec3s(m_positions.data() + begin, m_velocities.data() + begin, end - begin, deltaSeconds);
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// Called before each fixed step, so anything script or the demo animation did since the last step counts as
+// where the prop was
+void PropPool::StorePreviousTransforms()
+{
+    m_previousPositions    = m_positions;
+    m_previousOrientations = m_orientations;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Orientations are blended per Euler angle. Integration never wraps them, so consecutive steps are always close
+// and the straight blend takes the short way round.
+void PropPool::UpdateModelToWorldTransforms(float const interpolation)
+{
+    if (interpolation >= 1.f)
+    {
+        ParallelFor(GetCount(), TRANSFORM_CHUNK_SIZE, [this](int const begin, int const end)
+        {
+            BuildModelToWorldTransforms(m_positions.data() + begin, m_orientations.data() + begin, end - begin, m_modelToWorlds.data() + begin);
+        });
+
+        return;
+    }
+
+    ParallelFor(GetCount(), TRANSFORM_CHUNK_SIZE, [this, interpolation](int const begin, int const end)
+    {
+        // Blended in small blocks on the stack, so the matrix build still reads contiguous arrays
+        int constexpr BLOCK_SIZE = 256;
+        Vec3          positions[BLOCK_SIZE];
+        EulerAngles   orientations[BLOCK_SIZE];
+
+        for (int blockBegin = begin; blockBegin < end; blockBegin += BLOCK_SIZE)
+        {
+            int const blockCount = std::min(BLOCK_SIZE, end - blockBegin);
+
+            for (int i = 0; i < blockCount; ++i)
+            {
+                Vec3 const&        previousPosition    = m_previousPositions[blockBegin + i];
+                Vec3 const&        currentPosition     = m_positions[blockBegin + i];
+                EulerAngles const& previousOrientation = m_previousOrientations[blockBegin + i];
+                EulerAngles const& currentOrientation  = m_orientations[blockBegin + i];
+
+                positions[i]                   = previousPosition + (currentPosition - previousPosition) * interpolation;
+                orientations[i].m_yawDegrees   = Interpolate(previousOrientation.m_yawDegrees, currentOrientation.m_yawDegrees, interpolation);
+                orientations[i].m_pitchDegrees = Interpolate(previousOrientation.m_pitchDegrees, currentOrientation.m_pitchDegrees, interpolation);
+                orientations[i].m_rollDegrees  = Interpolate(previousOrientation.m_rollDegrees, currentOrientation.m_rollDegrees, interpolation);
+            }
+
+            BuildModelToWorldTransforms(positions, orientations, blockCount, m_modelToWorlds.data() + blockBegin);
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+PropMeshCache const& PropPool::GetMeshCache() const
+{
+    return m_meshCache;
+}
@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------------------------------
+// PropPool.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Gameplay/PropMeshCache.hpp"
+
+#include <deque>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Texture;
+
+//----------------------------------------------------------------------------------------------------
+// Generational prop identifier: the low PROP_HANDLE_SLOT_BITS are the slot, the bits above count how many times
+// that slot has been reused. A handle kept after its prop was destroyed no longer matches the slot's generation,
+// so moveProp / submitCommands with it are rejected instead of hitting whichever prop recycled the slot. Slots
+// start at generation 0, so until a slot is reused its handle equals its index and the first props spawned keep
+// the indices script already uses.
+//
+// Handles travel through script as float command payloads, so slot + generation stay within 24 bits to remain
+// exact; a single slot's generation wraps after PROP_HANDLE_MAX_GENERATION reuses.
+using PropHandle = int;
+
+PropHandle constexpr INVALID_PROP_HANDLE         = -1;
+int constexpr        PROP_HANDLE_SLOT_BITS       = 17;
+int constexpr        PROP_HANDLE_GENERATION_BITS = 7;
+int constexpr        PROP_HANDLE_MAX_SLOTS       = 1 << PROP_HANDLE_SLOT_BITS;
+int constexpr        PROP_HANDLE_MAX_GENERATION  = 1 << PROP_HANDLE_GENERATION_BITS;
+
+//----------------------------------------------------------------------------------------------------
+// Structure-of-arrays storage for every prop in the scene.
+//
+// Each component lives in its own dense array, so integration and rendering walk contiguous memory instead
+// of chasing one heap allocation and vtable per prop. Destroying a prop swaps the last prop into its dense
+// index; handles go through m_denseIndexBySlot, so they stay valid across that move.
+//
+// Freed slots are recycled oldest-first, which keeps a slot's generation climbing as slowly as possible. The
+// arrays only ever grow to the peak live prop count, so a long spawn / destroy cycle runs at flat memory with
+// no per-prop allocation.
+//
+// The component arrays are public for the hot loops; only Spawn() and Destroy() may change their length.
+//
+class PropPool
+{
+public:
+    PropHandle Spawn(ePropMesh mesh, Vec3 const& position, Rgba8 const& color = Rgba8::WHITE, Texture const* texture = nullptr);
+    PropHandle Spawn(sPropMeshDesc const& meshDesc, Vec3 const& position, Rgba8 const& color = Rgba8::WHITE, Texture const* texture = nullptr);
+    bool       Destroy(PropHandle handle);
+
+    bool       IsAlive(PropHandle handle) const;
+    int        GetDenseIndex(PropHandle handle) const;
+    PropHandle GetHandle(int denseIndex) const;
+    PropHandle GetHandleForSlot(int slot) const;     // INVALID_PROP_HANDLE for a free slot
+    int        GetCount() const;
+    int        GetSlotCount() const;
+
+    static int GetSlot(PropHandle handle);
+
+    void Integrate(float deltaSeconds);
+    void StorePreviousTransforms();
+    void UpdateModelToWorldTransforms(float interpolation = 1.f);     // 0 = previous transforms, 1 = current
+
+    PropMeshCache const& GetMeshCache() const;
+
+    std::vector<Vec3>           m_positions;
+    std::vector<Vec3>           m_velocities;
+    std::vector<EulerAngles>    m_orientations;
+    std::vector<EulerAngles>    m_angularVelocities;
+    std::vector<Rgba8>          m_colors;
+    std::vector<PropMeshID>     m_meshIDs;
+    std::vector<Texture const*> m_textures;
+    std::vector<Mat44>          m_modelToWorlds;     // Derived from positions / orientations, rebuilt by PropRenderer every frame
+
+    // Positions / orientations before the last fixed simulation step, for rendering between steps
+    std::vector<Vec3>           m_previousPositions;
+    std::vector<EulerAngles>    m_previousOrientations;
+
+private:
+    std::vector<PropHandle> m_handleByDenseIndex;
+    std::vector<int>        m_denseIndexBySlot;       // -1 while the slot is free
+    std::vector<int>        m_generationBySlot;
+    std::deque<int>         m_freeSlots;              // Oldest freed first
+
+    PropMeshCache m_meshCache;
+};
@@ -0,0 +1,512 @@
+//----------------------------------------------------------------------------------------------------
+// PropRenderer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/PropRenderer.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
+#include "Game/Framework/AllocationTracker.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/ParallelFor.hpp"
+#include "Game/Framework/Profiler.hpp"
+#include "Game/Gameplay/PropSpatialGrid.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+// Below this many props a group is cheaper to draw per prop from the static vertex buffer than to bake
+int constexpr PROP_BATCH_MIN_INSTANCES = 8;
+
+// Props baked per ParallelFor chunk
+int constexpr PROP_BAKE_CHUNK_SIZE = 256;
+
+//----------------------------------------------------------------------------------------------------
+static unsigned char MultiplyColorChannel(unsigned char const a, unsigned char const b)
+{
+    return static_cast<unsigned char>((static_cast<unsigned int>(a) * static_cast<unsigned int>(b) + 127u) / 255u);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Writes the mesh transformed into world space with the prop tint applied, matching what the shader does with
+// ModelConstants (modelToWorld, modelTint) on the unbatched path
+static void WriteTransformedVerts(Vertex_PCU* dst, Vertex_PCU const* localVerts, int const vertCount, Mat44 const& modelToWorld, Rgba8 const& tint)
+{
+    float const* m = modelToWorld.m_values;
+
+    for (Vertex_PCU const* src = localVerts; src != localVerts + vertCount; ++src)
+    {
+        Vec3 const& p = src->m_position;
+
+        dst->m_position.x  = m[Mat44::Ix] * p.x + m[Mat44::Jx] * p.y + m[Mat44::Kx] * p.z + m[Mat44::Tx];
+        dst->m_position.y  = m[Mat44::Iy] * p.x + m[Mat44::Jy] * p.y + m[Mat44::Ky] * p.z + m[Mat44::Ty];
+        dst->m_position.z  = m[Mat44::Iz] * p.x + m[Mat44::Jz] * p.y + m[Mat44::Kz] * p.z + m[Mat44::Tz];
+        dst->m_color.r     = MultiplyColorChannel(src->m_color.r, tint.r);
+        dst->m_color.g     = MultiplyColorChannel(src->m_color.g, tint.g);
+        dst->m_color.b     = MultiplyColorChannel(src->m_color.b, tint.b);
+        dst->m_color.a     = MultiplyColorChannel(src->m_color.a, tint.a);
+        dst->m_uvTexCoords = src->m_uvTexCoords;
+        ++dst;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+PropRenderer::~PropRenderer()
+{
+    StopPrepareThread();
+
+    for (sPropFrame& frame : m_frames)
+    {
+        for (sPropBatch& batch : frame.m_batches)
+        {
+            GAME_SAFE_RELEASE(batch.m_vertexBuffer);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropRenderer::Render(PropPool& propPool, PropSpatialGrid const& spatialGrid, sViewFrustum const& frustum, float const interpolation)
+{
+    sPropFrame& frame = m_frames[0];
+
+    Capture(frame, propPool, spatialGrid, frustum, interpolation);
+    Prepare(frame, true);
+    Draw(frame);
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropRenderer::SetPipelined(bool const isPipelined)
+{
+    if (isPipelined == m_isPipelined)
+    {
+        return;
+    }
+
+    StopPrepareThread();
+
+    m_isPipelined       = isPipelined;
+    m_captureFrameIndex = -1;
+    m_drawFrameIndex    = -1;
+
+    if (m_isPipelined)
+    {
+        m_isStopping    = false;
+        m_prepareThread = std::thread(&PropRenderer::RunPrepareThread, this);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool PropRenderer::IsPipelined() const
+{
+    return m_isPipelined;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The previous capture has to be prepared before it can be drawn, so this is where a prepare that took longer
+// than a whole frame stalls the simulation. The frame written here is the one Draw used last frame.
+void PropRenderer::CaptureFrame(PropPool& propPool, PropSpatialGrid const& spatialGrid, Camera const& camera, sViewFrustum const& frustum, float const interpolation)
+{
+    GUARANTEE_OR_DIE(m_isPipelined, "PropRenderer::CaptureFrame: pipelined mode is off")
+
+    {
+        PROFILE_SCOPE("PropRenderer::WaitForPrepare");
+        WaitForPrepare();
+    }
+
+    m_drawFrameIndex    = m_captureFrameIndex;
+    m_captureFrameIndex = m_captureFrameIndex == 0 ? 1 : 0;
+
+    sPropFrame& frame = m_frames[m_captureFrameIndex];
+    Capture(frame, propPool, spatialGrid, frustum, interpolation);
+    frame.m_camera = camera;
+
+    {
+        std::lock_guard lock(m_prepareMutex);
+        m_pendingFrameIndex = m_captureFrameIndex;
+    }
+    m_prepareCondition.notify_all();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Nothing is drawn until the second capture; the first one is still being prepared
+void PropRenderer::RenderCapturedFrame()
+{
+    if (m_drawFrameIndex < 0)
+    {
+        return;
+    }
+
+    Draw(m_frames[m_drawFrameIndex]);
+}
+
+//----------------------------------------------------------------------------------------------------
+Camera const* PropRenderer::GetRenderCamera() const
+{
+    return m_drawFrameIndex >= 0 ? &m_frames[m_drawFrameIndex].m_camera : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+int PropRenderer::GetLastVisibleCount() const
+{
+    return m_lastVisibleCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+int PropRenderer::GetLastDrawCallCount() const
+{
+    return m_lastDrawCallCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+int PropRenderer::GetLastStateChangeCount() const
+{
+    return m_lastStateChangeCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Main thread: everything that reads the pool, the grid or the mesh cache happens here
+void PropRenderer::Capture(sPropFrame& frame, PropPool& propPool, PropSpatialGrid const& spatialGrid, sViewFrustum const& frustum, float const interpolation)
+{
+    PROFILE_SCOPE("PropRenderer::Capture");
+
+    propPool.UpdateModelToWorldTransforms(interpolation);
+    spatialGrid.QueryFrustum(propPool, frustum, m_visibleDenseIndices);
+
+    frame.m_modelToWorlds.clear();
+    frame.m_colors.clear();
+    frame.m_meshIDs.clear();
+    frame.m_textures.clear();
+
+    for (int const denseIndex : m_visibleDenseIndices)
+    {
+        frame.m_modelToWorlds.push_back(propPool.m_modelToWorlds[denseIndex]);
+        frame.m_colors.push_back(propPool.m_colors[denseIndex]);
+        frame.m_meshIDs.push_back(propPool.m_meshIDs[denseIndex]);
+        frame.m_textures.push_back(propPool.m_textures[denseIndex]);
+    }
+
+    PropMeshCache const& meshCache = propPool.GetMeshCache();
+    frame.m_meshes.resize(meshCache.GetMeshCount());
+
+    for (PropMeshID meshID = 0; meshID < meshCache.GetMeshCount(); ++meshID)
+    {
+        sPropMeshView& mesh = frame.m_meshes[meshID];
+        mesh.m_verts        = meshCache.GetVerts(meshID).data();
+        mesh.m_vertCount    = static_cast<int>(meshCache.GetVerts(meshID).size());
+        mesh.m_vertexBuffer = meshCache.GetVertexBuffer(meshID);
+        mesh.m_shader       = meshCache.GetShader(meshID);
+        mesh.m_renderState  = meshCache.GetRenderState(meshID);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Reads only the frame, so it can run on the prepare thread. ParallelFor is main-thread only; the prepare
+// thread bakes serially, which is fine while it overlaps the rest of the frame.
+void PropRenderer::Prepare(sPropFrame& frame, bool const canUseParallelFor)
+{
+    PROFILE_SCOPE("PropRenderer::Prepare");
+    ALLOCATION_TAG("PropRenderer");
+
+    for (sPropBatch& batch : frame.m_batches)
+    {
+        batch.m_propIndices.clear();
+    }
+
+    // Consecutive props usually share a group (spawned cubes), so the last batch is checked before searching
+    sPropBatch* lastBatch = nullptr;
+
+    for (int i = 0; i < static_cast<int>(frame.m_meshIDs.size()); ++i)
+    {
+        PropMeshID const     meshID  = frame.m_meshIDs[i];
+        Texture const* const texture = frame.m_textures[i];
+
+        if (lastBatch == nullptr || lastBatch->m_meshID != meshID || lastBatch->m_texture != texture)
+        {
+            lastBatch = &GetOrCreateBatch(frame, meshID, texture);
+        }
+
+        lastBatch->m_propIndices.push_back(i);
+    }
+
+    for (sPropBatch& batch : frame.m_batches)
+    {
+        if (static_cast<int>(batch.m_propIndices.size()) < PROP_BATCH_MIN_INSTANCES || IsBakeCurrent(frame, batch))
+        {
+            continue;
+        }
+
+        batch.m_bakedModelToWorlds.clear();
+        batch.m_bakedColors.clear();
+        for (int const propIndex : batch.m_propIndices)
+        {
+            batch.m_bakedModelToWorlds.push_back(frame.m_modelToWorlds[propIndex]);
+            batch.m_bakedColors.push_back(frame.m_colors[propIndex]);
+        }
+
+        // Every prop owns a fixed span of the batch, so chunks can be baked on any worker
+        sPropMeshView const& mesh = frame.m_meshes[batch.m_meshID];
+        batch.m_verts.resize(batch.m_propIndices.size() * mesh.m_vertCount);
+        batch.m_isUploadPending = true;
+
+        auto const bakeRange = [&](int const begin, int const end)
+        {
+            for (int i = begin; i < end; ++i)
+            {
+                int const propIndex = batch.m_propIndices[i];
+                WriteTransformedVerts(batch.m_verts.data() + i * mesh.m_vertCount, mesh.m_verts, mesh.m_vertCount, frame.m_modelToWorlds[propIndex], frame.m_colors[propIndex]);
+            }
+        };
+
+        int const propCount = static_cast<int>(batch.m_propIndices.size());
+
+        if (canUseParallelFor)
+        {
+            ParallelFor(propCount, PROP_BAKE_CHUNK_SIZE, bakeRange);
+        }
+        else
+        {
+            bakeRange(0, propCount);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropRenderer::Draw(sPropFrame& frame)
+{
+    PROFILE_SCOPE("PropRenderer::Draw");
+
+    // Whatever ran before us may have changed any of these, so the first group sets everything
+    sPropRenderState const* boundState   = nullptr;
+    Shader const*           boundShader  = nullptr;
+    Texture const*          boundTexture = nullptr;
+    bool                    isFirstGroup = true;
+
+    m_lastVisibleCount     = static_cast<int>(frame.m_meshIDs.size());
+    m_lastDrawCallCount    = 0;
+    m_lastStateChangeCount = 0;
+
+    for (int const batchIndex : frame.m_drawOrder)
+    {
+        sPropBatch& batch = frame.m_batches[batchIndex];
+
+        if (batch.m_propIndices.empty())
+        {
+            continue;
+        }
+
+        sPropMeshView const&    mesh        = frame.m_meshes[batch.m_meshID];
+        sPropRenderState const& renderState = mesh.m_renderState;
+
+        if (isFirstGroup || renderState.m_blendMode != boundState->m_blendMode)
+        {
+            g_renderer->SetBlendMode(renderState.m_blendMode);
+            ++m_lastStateChangeCount;
+        }
+        if (isFirstGroup || renderState.m_depthMode != boundState->m_depthMode)
+        {
+            g_renderer->SetDepthMode(renderState.m_depthMode);
+            ++m_lastStateChangeCount;
+        }
+        if (isFirstGroup || renderState.m_rasterizerMode != boundState->m_rasterizerMode)
+        {
+            g_renderer->SetRasterizerMode(renderState.m_rasterizerMode);
+            ++m_lastStateChangeCount;
+        }
+        if (isFirstGroup || renderState.m_samplerMode != boundState->m_samplerMode)
+        {
+            g_renderer->SetSamplerMode(renderState.m_samplerMode);
+            ++m_lastStateChangeCount;
+        }
+        if (isFirstGroup || mesh.m_shader != boundShader)
+        {
+            g_renderer->BindShader(mesh.m_shader);
+            ++m_lastStateChangeCount;
+        }
+        if (isFirstGroup || batch.m_texture != boundTexture)
+        {
+            g_renderer->BindTexture(batch.m_texture);
+            ++m_lastStateChangeCount;
+        }
+
+        boundState   = &renderState;
+        boundShader  = mesh.m_shader;
+        boundTexture = batch.m_texture;
+        isFirstGroup = false;
+
+        if (static_cast<int>(batch.m_propIndices.size()) < PROP_BATCH_MIN_INSTANCES)
+        {
+            for (int const propIndex : batch.m_propIndices)
+            {
+                g_renderer->SetModelConstants(frame.m_modelToWorlds[propIndex], frame.m_colors[propIndex]);
+                g_renderer->DrawVertexBuffer(mesh.m_vertexBuffer, static_cast<unsigned int>(mesh.m_vertCount));
+                ++m_lastDrawCallCount;
+            }
+
+            continue;
+        }
+
+        if (batch.m_isUploadPending)
+        {
+            unsigned int const stride = sizeof(Vertex_PCU);
+            unsigned int const size   = static_cast<unsigned int>(batch.m_verts.size()) * stride;
+
+            if (size > batch.m_vertexBufferBytes)
+            {
+                // Grown with headroom so a group gaining a few props does not recreate it
+                GAME_SAFE_RELEASE(batch.m_vertexBuffer);
+                batch.m_vertexBufferBytes = size * 2;
+                batch.m_vertexBuffer      = g_renderer->CreateVertexBuffer(batch.m_vertexBufferBytes, stride);
+            }
+
+            g_renderer->CopyCPUToGPU(batch.m_verts.data(), size, batch.m_vertexBuffer);
+            batch.m_isUploadPending = false;
+        }
+
+        g_renderer->SetModelConstants();
+        g_renderer->DrawVertexBuffer(batch.m_vertexBuffer, static_cast<unsigned int>(batch.m_verts.size()));
+        ++m_lastDrawCallCount;
+    }
+
+    g_renderer->SetModelConstants();
+}
+
+//----------------------------------------------------------------------------------------------------
+// True when the batch's vertex buffer already holds exactly this frame's members, transforms and tints
+bool PropRenderer::IsBakeCurrent(sPropFrame const& frame, sPropBatch const& batch)
+{
+    if (batch.m_vertexBuffer == nullptr && !batch.m_isUploadPending)
+    {
+        return false;
+    }
+    if (batch.m_bakedModelToWorlds.size() != batch.m_propIndices.size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < static_cast<int>(batch.m_propIndices.size()); ++i)
+    {
+        int const    propIndex = batch.m_propIndices[i];
+        Rgba8 const& color     = frame.m_colors[propIndex];
+        Rgba8 const& baked     = batch.m_bakedColors[i];
+
+        if (std::memcmp(&frame.m_modelToWorlds[propIndex], &batch.m_bakedModelToWorlds[i], sizeof(Mat44)) != 0 ||
+            color.r != baked.r || color.g != baked.g || color.b != baked.b || color.a != baked.a)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// New groups are rare (a new mesh or texture), so the draw order is re-sorted only when one is added
+PropRenderer::sPropBatch& PropRenderer::GetOrCreateBatch(sPropFrame& frame, PropMeshID const meshID, Texture const* texture)
+{
+    for (sPropBatch& batch : frame.m_batches)
+    {
+        if (batch.m_meshID == meshID && batch.m_texture == texture)
+        {
+            return batch;
+        }
+    }
+
+    sPropBatch& batch = frame.m_batches.emplace_back();
+    batch.m_meshID    = meshID;
+    batch.m_texture   = texture;
+    batch.m_sortKey   = ComputeSortKey(frame.m_meshes[meshID], texture);
+
+    frame.m_drawOrder.push_back(static_cast<int>(frame.m_batches.size()) - 1);
+    std::sort(frame.m_drawOrder.begin(), frame.m_drawOrder.end(), [&frame](int const a, int const b)
+    {
+        return frame.m_batches[a].m_sortKey < frame.m_batches[b].m_sortKey;
+    });
+
+    return batch;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Most expensive change in the highest bits: render state, then shader, then texture.
+// Shaders and textures are ranked by first use rather than by address so the order is stable between runs.
+uint64_t PropRenderer::ComputeSortKey(sPropMeshView const& mesh, Texture const* texture)
+{
+    sPropRenderState const& renderState = mesh.m_renderState;
+
+    uint64_t const blendMode      = static_cast<uint64_t>(renderState.m_blendMode);
+    uint64_t const depthMode      = static_cast<uint64_t>(renderState.m_depthMode);
+    uint64_t const rasterizerMode = static_cast<uint64_t>(renderState.m_rasterizerMode);
+    uint64_t const samplerMode    = static_cast<uint64_t>(renderState.m_samplerMode);
+    uint64_t const shaderOrdinal  = static_cast<uint64_t>(GetOrAddOrdinal(m_shaderOrdinals, mesh.m_shader));
+    uint64_t const textureOrdinal = static_cast<uint64_t>(GetOrAddOrdinal(m_textureOrdinals, texture));
+
+    return blendMode << 56 | depthMode << 48 | rasterizerMode << 40 | samplerMode << 32 | shaderOrdinal << 16 | textureOrdinal;
+}
+
+//----------------------------------------------------------------------------------------------------
+int PropRenderer::GetOrAddOrdinal(std::vector<void const*>& ordinals, void const* resource)
+{
+    auto const found = std::find(ordinals.begin(), ordinals.end(), resource);
+    if (found != ordinals.end())
+    {
+        return static_cast<int>(found - ordinals.begin());
+    }
+
+    ordinals.push_back(resource);
+    return static_cast<int>(ordinals.size()) - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropRenderer::RunPrepareThread()
+{
+    ProfilerSetThreadName("PropPrepare");
+
+    std::unique_lock lock(m_prepareMutex);
+
+    while (true)
+    {
+        m_prepareCondition.wait(lock, [this] { return m_isStopping || m_pendingFrameIndex >= 0; });
+
+        if (m_isStopping)
+        {
+            return;
+        }
+
+        sPropFrame& frame = m_frames[m_pendingFrameIndex];
+
+        lock.unlock();
+        Prepare(frame, false);
+        lock.lock();
+
+        m_pendingFrameIndex = -1;
+        m_prepareCondition.notify_all();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropRenderer::WaitForPrepare()
+{
+    std::unique_lock lock(m_prepareMutex);
+    m_prepareCondition.wait(lock, [this] { return m_pendingFrameIndex < 0; });
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropRenderer::StopPrepareThread()
+{
+    if (!m_prepareThread.joinable())
+    {
+        return;
+    }
+
+    WaitForPrepare();
+
+    {
+        std::lock_guard lock(m_prepareMutex);
+        m_isStopping = true;
+    }
+    m_prepareCondition.notify_all();
+    m_prepareThread.join();
+}
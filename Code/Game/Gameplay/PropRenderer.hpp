@@ -0,0 +1,142 @@
+//----------------------------------------------------------------------------------------------------
+// PropRenderer.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Renderer/Camera.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+#include "Game/Gameplay/PropPool.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class PropSpatialGrid;
+struct sViewFrustum;
+
+//----------------------------------------------------------------------------------------------------
+// Draws the props of a PropPool that intersect the view frustum, grouped by (mesh, texture). With a fixed
+// simulation timestep, interpolation places each prop between its previous and current step (see PropPool).
+//
+// Groups of at least PROP_BATCH_MIN_INSTANCES props are expanded into a single world-space vertex list (model
+// transform and tint baked into each vertex) and drawn with identity model constants. The cost moves from one
+// constant buffer update + draw per prop to a linear vertex transform on the CPU, which is far cheaper at the
+// prop counts CubeSpawner reaches. Each group keeps its baked list in its own dynamic vertex buffer, and only
+// re-bakes and re-uploads it when a member, a transform or a tint differs from the last bake. A group whose
+// props hold still costs one comparison pass and one draw, with nothing uploaded.
+//
+// Smaller groups (the grid, the textured sphere) draw each prop straight from the mesh's static vertex buffer
+// in PropMeshCache with per-prop model constants, so their vertexes are never re-uploaded.
+//
+// Groups are drawn in sort-key order (render state, then shader, then texture), and render state, shader and
+// texture are only sent to the Renderer when they differ from what the previous group bound.
+//
+// Every frame goes through the same three steps: capture (copy the visible props and the camera into a frame),
+// prepare (group and bake) and draw. Render() runs all three back to back. In pipelined mode CaptureFrame() is
+// called at the end of the simulation update and hands the frame to a prepare thread, and RenderCapturedFrame()
+// draws the frame captured one update earlier. Baking then overlaps with present and the next script update,
+// at the cost of drawing props (and the world camera, see GetRenderCamera) one frame late. Two frames are kept,
+// so capture never writes to the one being drawn.
+//
+class PropRenderer
+{
+public:
+    PropRenderer() = default;
+    ~PropRenderer();
+
+    PropRenderer(PropRenderer const&)            = delete;
+    PropRenderer& operator=(PropRenderer const&) = delete;
+
+    // Immediate mode: capture, prepare and draw this frame's props now
+    void Render(PropPool& propPool, PropSpatialGrid const& spatialGrid, sViewFrustum const& frustum, float interpolation = 1.f);
+
+    // Pipelined mode; switching either way waits for the prepare thread and drops any captured frame
+    void SetPipelined(bool isPipelined);
+    bool IsPipelined() const;
+    void CaptureFrame(PropPool& propPool, PropSpatialGrid const& spatialGrid, Camera const& camera, sViewFrustum const& frustum, float interpolation = 1.f);
+    void RenderCapturedFrame();
+
+    // Camera of the frame RenderCapturedFrame() draws, so the rest of the world pass can match it; nullptr
+    // before the first frame has been captured
+    Camera const* GetRenderCamera() const;
+
+    int GetLastVisibleCount() const;
+    int GetLastDrawCallCount() const;
+    int GetLastStateChangeCount() const;
+
+private:
+    // What drawing a mesh needs, copied out of PropMeshCache so the prepare thread never reads the cache while
+    // the simulation adds to it. m_verts points into the cache's CPU copy, which is never changed or freed
+    // until the pool is destroyed.
+    struct sPropMeshView
+    {
+        Vertex_PCU const*   m_verts        = nullptr;
+        int                 m_vertCount    = 0;
+        VertexBuffer const* m_vertexBuffer = nullptr;
+        Shader const*       m_shader       = nullptr;
+        sPropRenderState    m_renderState;
+    };
+
+    struct sPropBatch
+    {
+        PropMeshID       m_meshID  = 0;
+        Texture const*   m_texture = nullptr;
+        uint64_t         m_sortKey = 0;
+        std::vector<int> m_propIndices;      // Props in this group this frame, as indices into the frame
+
+        // Large groups only. What the last bake was made from, to tell whether this frame needs a new one.
+        std::vector<Mat44> m_bakedModelToWorlds;
+        std::vector<Rgba8> m_bakedColors;
+        VertexList_PCU     m_verts;                        // Baked world-space vertexes
+        VertexBuffer*      m_vertexBuffer      = nullptr;  // m_verts on the GPU, as of the last upload
+        unsigned int       m_vertexBufferBytes = 0;
+        bool               m_isUploadPending   = false;    // Baked by Prepare, not yet copied by Draw
+    };
+
+    // Visible props of one update, compacted, plus everything derived from them
+    struct sPropFrame
+    {
+        std::vector<Mat44>          m_modelToWorlds;
+        std::vector<Rgba8>          m_colors;
+        std::vector<PropMeshID>     m_meshIDs;
+        std::vector<Texture const*> m_textures;
+        std::vector<sPropMeshView>  m_meshes;              // Indexed by PropMeshID
+        Camera                      m_camera;
+        std::vector<sPropBatch>     m_batches;
+        std::vector<int>            m_drawOrder;           // Indices into m_batches sorted by sort key
+    };
+
+    static bool IsBakeCurrent(sPropFrame const& frame, sPropBatch const& batch);
+
+    void        Capture(sPropFrame& frame, PropPool& propPool, PropSpatialGrid const& spatialGrid, sViewFrustum const& frustum, float interpolation);
+    void        Prepare(sPropFrame& frame, bool canUseParallelFor);
+    void        Draw(sPropFrame& frame);
+    sPropBatch& GetOrCreateBatch(sPropFrame& frame, PropMeshID meshID, Texture const* texture);
+    uint64_t    ComputeSortKey(sPropMeshView const& mesh, Texture const* texture);
+    static int  GetOrAddOrdinal(std::vector<void const*>& ordinals, void const* resource);
+
+    void RunPrepareThread();
+    void WaitForPrepare();
+    void StopPrepareThread();
+
+    sPropFrame               m_frames[2];
+    std::vector<void const*> m_shaderOrdinals;            // First-seen order of shaders / textures, for the sort key;
+    std::vector<void const*> m_textureOrdinals;           // only touched by whichever thread prepares
+    std::vector<int>         m_visibleDenseIndices;       // Frustum query result, reused every frame
+    int                      m_lastVisibleCount     = 0;
+    int                      m_lastDrawCallCount    = 0;
+    int                      m_lastStateChangeCount = 0;
+
+    // Pipelined mode. m_captureFrameIndex is the frame the last CaptureFrame() wrote; the one before it is drawn.
+    bool                     m_isPipelined         = false;
+    int                      m_captureFrameIndex   = -1;
+    int                      m_drawFrameIndex      = -1;
+    int                      m_pendingFrameIndex   = -1;   // Handed to the prepare thread, -1 once it is done
+    bool                     m_isStopping          = false;
+    std::thread              m_prepareThread;
+    std::mutex               m_prepareMutex;
+    std::condition_variable  m_prepareCondition;
+};
@@ -0,0 +1,339 @@
+//----------------------------------------------------------------------------------------------------
+// PropSpatialGrid.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/PropSpatialGrid.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------
+// Cell coordinates are packed as three biased 21-bit integers, enough for +-1M cells per axis
+uint64_t constexpr CELL_COORD_BITS = 21;
+int64_t constexpr  CELL_COORD_BIAS = 1 << (CELL_COORD_BITS - 1);
+uint64_t constexpr CELL_COORD_MASK = (1ull << CELL_COORD_BITS) - 1;
+uint64_t constexpr OVERSIZED_CELL  = ~0ull;
+
+//----------------------------------------------------------------------------------------------------
+static uint64_t PackCellKey(int const cellX, int const cellY, int const cellZ)
+{
+    uint64_t const x = static_cast<uint64_t>(cellX + CELL_COORD_BIAS) & CELL_COORD_MASK;
+    uint64_t const y = static_cast<uint64_t>(cellY + CELL_COORD_BIAS) & CELL_COORD_MASK;
+    uint64_t const z = static_cast<uint64_t>(cellZ + CELL_COORD_BIAS) & CELL_COORD_MASK;
+
+    return x << (2 * CELL_COORD_BITS) | y << CELL_COORD_BITS | z;
+}
+
+//----------------------------------------------------------------------------------------------------
+static Vec3 UnpackCellCenter(uint64_t const cellKey, float const cellSize)
+{
+    float const x = static_cast<float>(static_cast<int64_t>(cellKey >> (2 * CELL_COORD_BITS) & CELL_COORD_MASK) - CELL_COORD_BIAS);
+    float const y = static_cast<float>(static_cast<int64_t>(cellKey >> CELL_COORD_BITS & CELL_COORD_MASK) - CELL_COORD_BIAS);
+    float const z = static_cast<float>(static_cast<int64_t>(cellKey & CELL_COORD_MASK) - CELL_COORD_BIAS);
+
+    return Vec3(x + 0.5f, y + 0.5f, z + 0.5f) * cellSize;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Cell index of a position or query bound, clamped to the packable range before the int conversion, so a huge
+// or infinite value neither overflows the cast nor wraps around in PackCellKey
+//
+static int GetClampedCellCoord(float const coord, float const cellSize)
+{
+    double const cell = std::floor(static_cast<double>(coord) / static_cast<double>(cellSize));
+
+    return static_cast<int>(std::clamp(cell, static_cast<double>(-CELL_COORD_BIAS), static_cast<double>(CELL_COORD_BIAS - 1)));
+}
+
+//----------------------------------------------------------------------------------------------------
+static float GetPropRadius(PropPool const& propPool, int const denseIndex)
+{
+    return propPool.GetMeshCache().GetBoundingRadius(propPool.m_meshIDs[denseIndex]);
+}
+
+//----------------------------------------------------------------------------------------------------
+sViewFrustum sViewFrustum::MakePerspective(Vec3 const&        position,
+                                           EulerAngles const& orientation,
+                                           float const        aspect,
+                                           float const        fovDegrees,
+                                           float const        nearDistance,
+                                           float const        farDistance)
+{
+    Vec3 forward;
+    Vec3 left;
+    Vec3 up;
+    orientation.GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
+
+    float const tanHalfVertical   = std::tan(ConvertDegreesToRadians(fovDegrees * 0.5f));
+    float const tanHalfHorizontal = tanHalfVertical * aspect;
+    float const forwardDistance   = DotProduct3D(forward, position);
+
+    sViewFrustum frustum;
+
+    frustum.m_planes[0] = {forward, forwardDistance + nearDistance};
+    frustum.m_planes[1] = {-forward, -(forwardDistance + farDistance)};
+
+    // Side planes pass through the camera position, so their distance is just the normal projected onto it
+    Vec3 const sideNormals[4] =
+    {
+        (forward * tanHalfHorizontal - left).GetNormalized(),
+        (forward * tanHalfHorizontal + left).GetNormalized(),
+        (forward * tanHalfVertical - up).GetNormalized(),
+        (forward * tanHalfVertical + up).GetNormalized()
+    };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        frustum.m_planes[2 + i] = {sideNormals[i], DotProduct3D(sideNormals[i], position)};
+    }
+
+    return frustum;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool sViewFrustum::IsSphereVisible(Vec3 const& center, float const radius) const
+{
+    for (sPlane const& plane : m_planes)
+    {
+        if (DotProduct3D(plane.m_normal, center) - plane.m_distance < -radius)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+PropSpatialGrid::PropSpatialGrid(float const cellSize)
+    : m_cellSize(cellSize),
+      m_looseMargin(cellSize * 0.5f)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// A slot whose prop was destroyed (or destroyed and respawned) since the last update drops its old entry first
+void PropSpatialGrid::Update(PropPool const& propPool)
+{
+    int const slotCount = propPool.GetSlotCount();
+
+    m_handleBySlot.resize(slotCount, INVALID_PROP_HANDLE);
+    m_cellKeyBySlot.resize(slotCount, OVERSIZED_CELL);
+    m_listIndexBySlot.resize(slotCount, -1);
+
+    for (int slot = 0; slot < slotCount; ++slot)
+    {
+        PropHandle const handle = propPool.GetHandleForSlot(slot);
+
+        if (m_handleBySlot[slot] != INVALID_PROP_HANDLE && m_handleBySlot[slot] != handle)
+        {
+            Remove(slot);
+        }
+
+        if (handle == INVALID_PROP_HANDLE)
+        {
+            continue;
+        }
+
+        int const     denseIndex = propPool.GetDenseIndex(handle);
+        CellKey const cellKey    = GetPropRadius(propPool, denseIndex) > m_looseMargin ? OVERSIZED_CELL : GetCellKey(propPool.m_positions[denseIndex]);
+
+        if (m_handleBySlot[slot] == handle && m_cellKeyBySlot[slot] == cellKey)
+        {
+            continue;
+        }
+
+        if (m_handleBySlot[slot] != INVALID_PROP_HANDLE)
+        {
+            Remove(slot);
+        }
+        Insert(handle, cellKey);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropSpatialGrid::QuerySphere(PropPool const&          propPool,
+                                  Vec3 const&              center,
+                                  float const              radius,
+                                  std::vector<PropHandle>& out_handles) const
+{
+    out_handles.clear();
+
+    // Game::QueryPropsInRadius rejects these before they get here; a NaN bound would also slip past the clamp below
+    if (!std::isfinite(radius) || radius < 0.f || !std::isfinite(center.x) || !std::isfinite(center.y) || !std::isfinite(center.z))
+    {
+        return;
+    }
+
+    for (PropHandle const handle : m_oversizedHandles)
+    {
+        if (IsOverlapping(propPool, handle, center, radius))
+        {
+            out_handles.push_back(handle);
+        }
+    }
+
+    float const searchRadius = radius + m_looseMargin;
+
+    int const minX = GetClampedCellCoord(center.x - searchRadius, m_cellSize);
+    int const minY = GetClampedCellCoord(center.y - searchRadius, m_cellSize);
+    int const minZ = GetClampedCellCoord(center.z - searchRadius, m_cellSize);
+    int const maxX = GetClampedCellCoord(center.x + searchRadius, m_cellSize);
+    int const maxY = GetClampedCellCoord(center.y + searchRadius, m_cellSize);
+    int const maxZ = GetClampedCellCoord(center.z + searchRadius, m_cellSize);
+
+    auto const appendCell = [&](std::vector<PropHandle> const& handles)
+    {
+        for (PropHandle const handle : handles)
+        {
+            if (IsOverlapping(propPool, handle, center, radius))
+            {
+                out_handles.push_back(handle);
+            }
+        }
+    };
+
+    // A huge radius would visit mostly empty cells; walking the occupied ones is cheaper then
+    // Unsigned: the full clamped range is 2^63 cells
+    uint64_t const cellsInRange = static_cast<uint64_t>(maxX - minX + 1) * static_cast<uint64_t>(maxY - minY + 1) * static_cast<uint64_t>(maxZ - minZ + 1);
+
+    if (cellsInRange > static_cast<uint64_t>(m_cells.size()))
+    {
+        for (auto const& [cellKey, handles] : m_cells)
+        {
+            appendCell(handles);
+        }
+        return;
+    }
+
+    for (int cellZ = minZ; cellZ <= maxZ; ++cellZ)
+    {
+        for (int cellY = minY; cellY <= maxY; ++cellY)
+        {
+            for (int cellX = minX; cellX <= maxX; ++cellX)
+            {
+                auto const found = m_cells.find(PackCellKey(cellX, cellY, cellZ));
+                if (found != m_cells.end())
+                {
+                    appendCell(found->second);
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropSpatialGrid::QueryFrustum(PropPool const&     propPool,
+                                   sViewFrustum const& frustum,
+                                   std::vector<int>&   out_denseIndices) const
+{
+    out_denseIndices.clear();
+
+    auto const appendVisible = [&](PropHandle const handle)
+    {
+        int const denseIndex = propPool.GetDenseIndex(handle);
+
+        if (denseIndex >= 0 && frustum.IsSphereVisible(propPool.m_positions[denseIndex], GetPropRadius(propPool, denseIndex)))
+        {
+            out_denseIndices.push_back(denseIndex);
+        }
+    };
+
+    for (PropHandle const handle : m_oversizedHandles)
+    {
+        appendVisible(handle);
+    }
+
+    // Half the cell diagonal plus the loose margin bounds everything filed in a cell
+    float const cellBoundsRadius = m_cellSize * 0.8660254f + m_looseMargin;
+
+    for (auto const& [cellKey, handles] : m_cells)
+    {
+        if (!frustum.IsSphereVisible(UnpackCellCenter(cellKey, m_cellSize), cellBoundsRadius))
+        {
+            continue;
+        }
+
+        for (PropHandle const handle : handles)
+        {
+            appendVisible(handle);
+        }
+    }
+
+    std::sort(out_denseIndices.begin(), out_denseIndices.end());
+}
+
+//----------------------------------------------------------------------------------------------------
+// Positions come from script unchecked. A non-finite one goes in the oversized list, which every query tests
+// directly; one past the packable range lands in the edge cell, where queries that reach that far find it.
+//
+PropSpatialGrid::CellKey PropSpatialGrid::GetCellKey(Vec3 const& position) const
+{
+    if (!std::isfinite(position.x) || !std::isfinite(position.y) || !std::isfinite(position.z))
+    {
+        return OVERSIZED_CELL;
+    }
+
+    int const cellX = GetClampedCellCoord(position.x, m_cellSize);
+    int const cellY = GetClampedCellCoord(position.y, m_cellSize);
+    int const cellZ = GetClampedCellCoord(position.z, m_cellSize);
+
+    return PackCellKey(cellX, cellY, cellZ);
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropSpatialGrid::Insert(PropHandle const handle, CellKey const cellKey)
+{
+    std::vector<PropHandle>& handles = cellKey == OVERSIZED_CELL ? m_oversizedHandles : m_cells[cellKey];
+    int const                slot    = PropPool::GetSlot(handle);
+
+    m_handleBySlot[slot]    = handle;
+    m_cellKeyBySlot[slot]   = cellKey;
+    m_listIndexBySlot[slot] = static_cast<int>(handles.size());
+    handles.push_back(handle);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Swap-and-pop within the cell list; empty cells are erased so frustum queries only walk occupied ones
+void PropSpatialGrid::Remove(int const slot)
+{
+    CellKey const cellKey = m_cellKeyBySlot[slot];
+    auto const    found   = m_cells.find(cellKey);
+
+    std::vector<PropHandle>& handles = cellKey == OVERSIZED_CELL ? m_oversizedHandles : found->second;
+
+    int const        listIndex  = m_listIndexBySlot[slot];
+    PropHandle const lastHandle = handles.back();
+
+    handles[listIndex]                               = lastHandle;
+    m_listIndexBySlot[PropPool::GetSlot(lastHandle)] = listIndex;
+    handles.pop_back();
+
+    if (cellKey != OVERSIZED_CELL && handles.empty())
+    {
+        m_cells.erase(found);
+    }
+
+    m_handleBySlot[slot]    = INVALID_PROP_HANDLE;
+    m_listIndexBySlot[slot] = -1;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool PropSpatialGrid::IsOverlapping(PropPool const&  propPool,
+                                    PropHandle const handle,
+                                    Vec3 const&      center,
+                                    float const      radius) const
+{
+    int const denseIndex = propPool.GetDenseIndex(handle);
+    if (denseIndex < 0)
+    {
+        return false;
+    }
+
+    float const reach = radius + GetPropRadius(propPool, denseIndex);
+
+    return (propPool.m_positions[denseIndex] - center).GetLengthSquared() <= reach * reach;
+}
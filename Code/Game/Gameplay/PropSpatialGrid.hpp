@@ -0,0 +1,69 @@
+//----------------------------------------------------------------------------------------------------
+// PropSpatialGrid.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Gameplay/PropPool.hpp"
+
+#include <unordered_map>
+
+//----------------------------------------------------------------------------------------------------
+// Six inward-facing planes; a point p is inside a plane when DotProduct3D(m_normal, p) >= m_distance
+struct sViewFrustum
+{
+    struct sPlane
+    {
+        Vec3  m_normal;
+        float m_distance = 0.f;
+    };
+
+    sPlane m_planes[6];
+
+    // Matches Camera::SetPerspectiveGraphicView(aspect, fovDegrees, near, far) with the camera's i-forward, j-left, k-up basis
+    static sViewFrustum MakePerspective(Vec3 const& position, EulerAngles const& orientation, float aspect, float fovDegrees, float nearDistance, float farDistance);
+
+    bool IsSphereVisible(Vec3 const& center, float radius) const;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Loose uniform grid over prop bounding spheres. Cell lists hold handles; bookkeeping is per prop slot.
+//
+// Each prop is filed under the cell containing its center; queries widen their search by half a cell, so a prop
+// whose radius fits in that margin is always found. Props too big for that (the world grid) sit in a separate
+// list that every query tests. Update() runs once per frame after props have moved and only touches the cell
+// lists of props that crossed into a new cell, so a settled scene costs one pass over positions.
+//
+class PropSpatialGrid
+{
+public:
+    explicit PropSpatialGrid(float cellSize = 8.f);
+
+    void Update(PropPool const& propPool);
+
+    // Handles of live props whose bounds overlap the sphere, in no particular order
+    void QuerySphere(PropPool const& propPool, Vec3 const& center, float radius, std::vector<PropHandle>& out_handles) const;
+
+    // Dense indices of props whose bounds intersect the frustum, ascending so spawn-order batching is kept
+    void QueryFrustum(PropPool const& propPool, sViewFrustum const& frustum, std::vector<int>& out_denseIndices) const;
+
+private:
+    using CellKey = uint64_t;
+
+    CellKey GetCellKey(Vec3 const& position) const;
+    void    Insert(PropHandle handle, CellKey cellKey);
+    void    Remove(int slot);
+    bool    IsOverlapping(PropPool const& propPool, PropHandle handle, Vec3 const& center, float radius) const;
+
+    float m_cellSize;
+    float m_looseMargin;     // Largest prop radius that may be filed in a cell
+
+    std::unordered_map<CellKey, std::vector<PropHandle>> m_cells;
+    std::vector<PropHandle>                              m_oversizedHandles;
+    std::vector<PropHandle>                              m_handleBySlot;        // Handle filed for each slot, INVALID_PROP_HANDLE if none
+    std::vector<CellKey>                                 m_cellKeyBySlot;
+    std::vector<int>                                     m_listIndexBySlot;     // Index within its cell (or oversized) list
+};
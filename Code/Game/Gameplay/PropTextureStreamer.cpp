@@ -0,0 +1,200 @@
+//----------------------------------------------------------------------------------------------------
+// PropTextureStreamer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Gameplay/PropTextureStreamer.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Job.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Resource/ResourceSubsystem.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/ParallelFor.hpp"
+#include "Game/Framework/Profiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <thread>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    class PropTextureReadJob : public Job
+    {
+    public:
+        PropTextureReadJob(String path, int const entryIndex)
+            : Job(JOB_TYPE_IO)
+            , m_path(std::move(path))
+            , m_entryIndex(entryIndex)
+        {
+        }
+
+        // Reads the whole file and throws the bytes away: what matters is that they are in the OS cache
+        void Execute() override
+        {
+            PROFILE_SCOPE("PropTextureReadJob");
+
+            std::ifstream file(m_path, std::ios::binary);
+            if (!file.is_open())
+            {
+                return;
+            }
+
+            char buffer[64 * 1024];
+            while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+            {
+                m_byteCount += static_cast<size_t>(file.gcount());
+            }
+            m_isReadable = m_byteCount > 0;
+        }
+
+        String m_path;
+        int    m_entryIndex = -1;
+        size_t m_byteCount  = 0;
+        bool   m_isReadable = false;
+    };
+}
+
+//----------------------------------------------------------------------------------------------------
+PropTextureStreamer::~PropTextureStreamer()
+{
+    while (m_readsInFlight > 0)
+    {
+        CollectCompletedReads();
+        std::this_thread::yield();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool PropTextureStreamer::RequestTexture(PropPool&     propPool,
+                                         PropHandle    handle,
+                                         String const& path)
+{
+    if (!propPool.IsAlive(handle))
+    {
+        return false;
+    }
+
+    int entryIndex = -1;
+
+    if (auto const found = m_entryIndexByPath.find(path); found != m_entryIndexByPath.end())
+    {
+        entryIndex = found->second;
+    }
+    else
+    {
+        entryIndex = static_cast<int>(m_entries.size());
+        m_entries.push_back({path});
+        m_entryIndexByPath.emplace(path, entryIndex);
+
+        g_jobSystem->SubmitJob(new PropTextureReadJob(path, entryIndex));
+        ++m_readsInFlight;
+    }
+
+    // A later request for the same prop replaces the earlier one
+    std::erase_if(m_waitingProps, [handle](sWaitingProp const& waiting) { return waiting.m_handle == handle; });
+
+    switch (m_entries[entryIndex].m_state)
+    {
+    case eTextureState::LOADED:
+        propPool.m_textures[propPool.GetDenseIndex(handle)] = m_entries[entryIndex].m_texture;
+        break;
+    case eTextureState::FAILED:
+        break;
+    default:
+        m_waitingProps.push_back({handle, entryIndex});
+        break;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropTextureStreamer::Update(PropPool& propPool, int const maxCreatesPerFrame)
+{
+    if (m_readsInFlight > 0)
+    {
+        CollectCompletedReads();
+    }
+
+    // Failed reads only release their waiting props
+    for (int const entryIndex : m_failedEntries)
+    {
+        ApplyTexture(propPool, entryIndex);
+    }
+    m_failedEntries.clear();
+
+    for (int created = 0; created < maxCreatesPerFrame && !m_readEntries.empty(); ++created)
+    {
+        PROFILE_SCOPE("PropTextureStreamer::CreateTexture");
+
+        int const      entryIndex = m_readEntries.front();
+        sTextureEntry& entry      = m_entries[entryIndex];
+        m_readEntries.pop_front();
+
+        entry.m_texture = ResourceSubsystem::CreateOrGetTextureFromFile(entry.m_path.c_str());
+        entry.m_state   = entry.m_texture != nullptr ? eTextureState::LOADED : eTextureState::FAILED;
+
+        ApplyTexture(propPool, entryIndex);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int PropTextureStreamer::GetPendingCount() const
+{
+    return static_cast<int>(std::count_if(m_entries.begin(), m_entries.end(), [](sTextureEntry const& entry) {
+        return entry.m_state == eTextureState::READING || entry.m_state == eTextureState::READ;
+    }));
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropTextureStreamer::CollectCompletedReads()
+{
+    while (Job* const job = RetrieveCompletedGameJob())
+    {
+        PropTextureReadJob* readJob = dynamic_cast<PropTextureReadJob*>(job);
+        GUARANTEE_OR_DIE(readJob != nullptr, "PropTextureStreamer: found a completed job that is not a texture read")
+
+        sTextureEntry& entry = m_entries[readJob->m_entryIndex];
+
+        if (readJob->m_isReadable)
+        {
+            entry.m_state = eTextureState::READ;
+            m_readEntries.push_back(readJob->m_entryIndex);
+        }
+        else
+        {
+            entry.m_state = eTextureState::FAILED;
+            m_failedEntries.push_back(readJob->m_entryIndex);
+            DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(PropTextureStreamer::CollectCompletedReads)(cannot read {}; props keep their placeholder)", entry.m_path));
+        }
+
+        GAME_SAFE_RELEASE(readJob);
+        --m_readsInFlight;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropTextureStreamer::ApplyTexture(PropPool& propPool, int const entryIndex)
+{
+    Texture const* const texture = m_entries[entryIndex].m_texture;
+
+    std::erase_if(m_waitingProps, [&](sWaitingProp const& waiting) {
+        if (waiting.m_entryIndex != entryIndex)
+        {
+            return false;
+        }
+        if (texture != nullptr)
+        {
+            if (int const denseIndex = propPool.GetDenseIndex(waiting.m_handle); denseIndex >= 0)
+            {
+                propPool.m_textures[denseIndex] = texture;
+            }
+        }
+        return true;
+    });
+}
@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------------------------------
+// PropTextureStreamer.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Gameplay/PropPool.hpp"
+
+#include <deque>
+#include <unordered_map>
+
+//----------------------------------------------------------------------------------------------------
+// Textures for props, loaded without stalling the frame that asks for them.
+//
+// RequestTexture() never touches the disk. The prop keeps whatever texture it has (untextured white for a new
+// spawn) as the placeholder, and the file is read on a JobSystem I/O worker. Update(), once per frame on the
+// main thread, collects finished reads. It then creates at most maxCreatesPerFrame textures through
+// ResourceSubsystem and swaps each one into every live prop still waiting on it. Props destroyed while waiting
+// are skipped.
+//
+// The engine only creates textures from a file path on the main thread, so the decode and upload happen there.
+// The worker read moves the disk latency off the frame and the decode then reads from the OS file cache; the
+// per-frame cap bounds what a burst of requests costs any single frame. Each path is loaded once and shared.
+//
+class PropTextureStreamer
+{
+public:
+    PropTextureStreamer() = default;
+    ~PropTextureStreamer();     // Waits for reads still in flight
+
+    PropTextureStreamer(PropTextureStreamer const&)            = delete;
+    PropTextureStreamer& operator=(PropTextureStreamer const&) = delete;
+
+    // False if the prop is gone. A texture already loaded is applied right away.
+    bool RequestTexture(PropPool& propPool, PropHandle handle, String const& path);
+
+    void Update(PropPool& propPool, int maxCreatesPerFrame = 1);
+
+    int GetPendingCount() const;     // Textures requested but not created yet
+
+private:
+    enum class eTextureState : uint8_t
+    {
+        READING,
+        READ,        // On disk and read once; waiting for its turn to be created
+        LOADED,
+        FAILED
+    };
+
+    struct sTextureEntry
+    {
+        String         m_path;
+        Texture const* m_texture = nullptr;
+        eTextureState  m_state   = eTextureState::READING;
+    };
+
+    struct sWaitingProp
+    {
+        PropHandle m_handle     = INVALID_PROP_HANDLE;
+        int        m_entryIndex = -1;
+    };
+
+    void CollectCompletedReads();
+    void ApplyTexture(PropPool& propPool, int entryIndex);
+
+    std::vector<sTextureEntry>      m_entries;
+    std::unordered_map<String, int> m_entryIndexByPath;
+    std::vector<sWaitingProp>       m_waitingProps;
+    std::deque<int>                 m_readEntries;       // READ, oldest first
+    std::vector<int>                m_failedEntries;     // FAILED since the last Update
+    int                             m_readsInFlight = 0;
+};
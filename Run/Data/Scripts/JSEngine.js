@@ -15,24 +15,46 @@
  * - This file is CORE INFRASTRUCTURE - rarely edited
  * - Systems register with JSEngine and execute every frame
  * - Priority-based execution (0-100, lower = earlier)
+ * - Update systems may declare tickEveryFrames / tickHz / budgetMs (see core/SystemScheduler.js)
  * - Dual pattern support: legacy config objects + SystemComponent instances
  */
 
+import {PropCommandBuffer} from './core/PropCommandBuffer.js';
+import {profiler} from './core/Profiler.js';
+import {SystemScheduler, insertByPriority, nowMilliseconds, removeById} from './core/SystemScheduler.js';
+
 export class JSEngine {
     constructor() {
         this.game = null;
         this.isInitialized = true;
         this.frameCount = 0;
+        this.frameStepCount = 1;
 
         // System Registration
         this.registeredSystems = new Map();
-        this.updateSystems = [];
+        this.scheduler = new SystemScheduler();
+        this.updateSystems = this.scheduler.systems;     // Priority order, shared with the scheduler
+
+        // A recorded or replayed session must run the same systems every frame, whatever the frame cost
+        this.scheduler.isDeterministic = typeof game !== 'undefined' && typeof game.replayMode === 'string' && game.replayMode !== 'off';
         this.renderSystems = [];
         this.pendingOperations = [];
 
         // C++ Hot-Reload System (handled by C++ FileWatcher + ScriptReloader)
         this.hotReloadEnabled = true; // C++ hot-reload system availability flag
 
+        // Components of the engine this one replaced on a main.js reload, by id; see adoptPreviousEngine()
+        this.previousComponents = new Map();
+
+        // Prop mutations queued by systems during update(), sent to C++ in one game.submitCommands() call per frame
+        this.propCommands = new PropCommandBuffer();
+
+        // Reused by getPlayerPosition() so per-frame polling does not allocate
+        this.playerPositionScratch = {x: 0, y: 0, z: 0};
+
+        // Reused by queryPropsInRadius() when no output array is passed
+        this.propQueryScratch = [];
+
         console.log('JSEngine: Created with system registration support');
     }
 
@@ -44,6 +66,43 @@ export class JSEngine {
         console.log('JSEngine: Game instance set');
     }
 
+    /**
+     * Called by main.js when it is re-evaluated by a hot reload and a JSEngine is already running. Keeps the frame
+     * count (frame-based timers stay valid) and the old components, so registerSystem can migrate their state.
+     */
+    adoptPreviousEngine(previous) {
+        this.frameCount = previous.frameCount;
+
+        for (const system of previous.registeredSystems.values()) {
+            if (system.componentInstance) {
+                this.previousComponents.set(system.id, system.componentInstance);
+            }
+        }
+
+        console.log(`JSEngine: Adopted previous engine (frame ${this.frameCount}, ${this.previousComponents.size} components)`);
+    }
+
+    /**
+     * Hands a replaced component's state to its successor through the optional migrate(previous) hook
+     */
+    migrateComponent(component) {
+        const previous = this.registeredSystems.get(component.id)?.componentInstance ??
+                         this.previousComponents.get(component.id);
+        this.previousComponents.delete(component.id);
+
+        if (!previous || previous === component || typeof component.migrate !== 'function') {
+            return;
+        }
+
+        const startMs = nowMilliseconds();
+        try {
+            component.migrate(previous);
+            console.log(`JSEngine: Migrated '${component.id}' state in ${(nowMilliseconds() - startMs).toFixed(3)} ms`);
+        } catch (error) {
+            console.log(`JSEngine: migrate() failed for '${component.id}', starting fresh: ${error}`);
+        }
+    }
+
     // ============================================================================
     // SYSTEM REGISTRATION API (for AI agents and runtime modifications)
     // ============================================================================
@@ -71,6 +130,8 @@ export class JSEngine {
         if (isComponentInstance) {
             // SystemComponent instance pattern
             const component = configOrComponent;
+            this.migrateComponent(component);
+
             system = {
                 id: component.id,
                 update: component.update ? component.update.bind(component) : null,
@@ -78,6 +139,7 @@ export class JSEngine {
                 priority: component.priority,
                 enabled: component.enabled !== false,
                 data: component.data || {},
+                schedule: this.scheduler.createSchedule(component),
                 componentInstance: component // Keep reference for hot-reload detection
             };
 
@@ -95,7 +157,8 @@ export class JSEngine {
                 render: configOrComponent.render || null,
                 priority: configOrComponent.priority || 0,
                 enabled: configOrComponent.enabled !== false,
-                data: configOrComponent.data || {}
+                data: configOrComponent.data || {},
+                schedule: this.scheduler.createSchedule(configOrComponent)
             };
 
             console.log(`JSEngine: Registered system '${id}' (priority: ${system.priority}, legacy pattern)`);
@@ -153,6 +216,9 @@ export class JSEngine {
                 id: sys.id,
                 enabled: sys.enabled,
                 priority: sys.priority,
+                tickEveryFrames: sys.schedule.tickEveryFrames,
+                tickHz: sys.schedule.tickHz,
+                budgetMs: sys.schedule.budgetMs,
                 hasUpdate: sys.update !== null,
                 hasRender: sys.render !== null
             };
@@ -180,22 +246,24 @@ export class JSEngine {
     }
 
     addSystemToLists(system) {
+        // Re-registering an id replaces the old entry rather than running both
+        this.scheduler.remove(system.id);
+        removeById(this.renderSystems, system.id);
+
         if (system.update && typeof system.update === 'function') {
-            this.updateSystems.push(system);
-            this.updateSystems.sort((a, b) => a.priority - b.priority);
+            this.scheduler.add(system);
         }
 
         if (system.render && typeof system.render === 'function') {
-            this.renderSystems.push(system);
-            this.renderSystems.sort((a, b) => a.priority - b.priority);
+            insertByPriority(this.renderSystems, system);
         }
 
         console.log(`JSEngine: System '${system.id}' added to execution lists`);
     }
 
     removeSystemFromLists(id) {
-        this.updateSystems = this.updateSystems.filter(sys => sys.id !== id);
-        this.renderSystems = this.renderSystems.filter(sys => sys.id !== id);
+        this.scheduler.remove(id);
+        removeById(this.renderSystems, id);
         this.registeredSystems.delete(id);
 
         console.log(`JSEngine: System '${id}' removed from all lists`);
@@ -205,27 +273,56 @@ export class JSEngine {
      * Update method - called by C++ engine
      * Now processes both game and registered systems
      */
-    update(gameDeltaSeconds, systemDeltaSeconds) {
+    update(gameDeltaSeconds, systemDeltaSeconds, frameStepCount = 1) {
         if (!this.isInitialized) {
             return;
         }
 
-        this.frameCount++;
+        // With a fixed timestep C++ reports how many simulation steps this frame covers (possibly 0), so
+        // frame-count timers such as CubeSpawner's interval count steps and last the same at any frame rate
+        this.frameStepCount = frameStepCount;
+        this.frameCount += frameStepCount;
         this.processOperations();
 
-        // Execute all registered update systems
-        for (const system of this.updateSystems) {
-            if (system.enabled && system.update) {
-                try {
-                    // Pass both gameDeltaSeconds and systemDeltaSeconds to allow systems to choose
-                    system.update(gameDeltaSeconds, systemDeltaSeconds);
-                } catch (error) {
-                    console.log(`JSEngine: Error in system '${system.id}' update:`, error);
-                }
-            }
+        // Execute the registered update systems that are due this frame and fit the frame budget
+        this.scheduler.run(gameDeltaSeconds, systemDeltaSeconds, this.invokeSystemUpdate);
+
+        // One native crossing for everything the systems queued this frame; applied at the next game.update()
+        profiler.begin('JSEngine.flush');
+        this.propCommands.flush();
+        profiler.end();
+    }
+
+    /**
+     * Handed to the scheduler unbound (it never touches this), so the per-frame loop creates no closure
+     */
+    invokeSystemUpdate(system, gameDeltaSeconds, systemDeltaSeconds, slice) {
+        // One profiler zone per system, named by its id
+        profiler.begin(system.id);
+        try {
+            // Pass both gameDeltaSeconds and systemDeltaSeconds to allow systems to choose
+            system.update(gameDeltaSeconds, systemDeltaSeconds, slice);
+        } catch (error) {
+            console.log(`JSEngine: Error in system '${system.id}' update:`, error);
+        } finally {
+            profiler.end();
         }
     }
 
+    /**
+     * Per-system update cost, most expensive first (see SystemScheduler.getCostBreakdown)
+     */
+    getSystemCosts() {
+        return this.scheduler.getCostBreakdown();
+    }
+
+    /**
+     * Print the per-system cost breakdown to the console
+     */
+    logSystemCosts() {
+        console.log(this.scheduler.formatCostBreakdown());
+    }
+
     /**
      * Render method - called by C++ engine
      * Now processes both game and registered systems
@@ -272,32 +369,73 @@ export class JSEngine {
     /**
      * Helper methods for game to use C++ engine functions
      */
+    /**
+     * @returns {number} Handle of the new cube, or -1 when it could not be spawned
+     */
     createCube(x, y, z) {
         if (typeof game !== 'undefined' && game.createCube) {
-            game.createCube(x, y, z);
-            console.log(`JSEngine: Created cube at (${x.toFixed(2)}, ${y.toFixed(2)}, ${z.toFixed(2)})`);
-            return true;
+            const handle = game.createCube(x, y, z);
+            console.log(`JSEngine: Created cube ${handle} at (${x.toFixed(2)}, ${y.toFixed(2)}, ${z.toFixed(2)})`);
+            return handle;
         }
         console.warn('JSEngine: createCube not available');
-        return false;
+        return -1;
+    }
+
+    /**
+     * Queue destruction of a prop; its slot is recycled and the handle stops resolving
+     */
+    destroyProp(handle) {
+        this.propCommands.destroy(handle);
+        return true;
     }
 
     moveProp(index, x, y, z) {
-        if (typeof game !== 'undefined' && game.moveProp) {
-            game.moveProp(index, x, y, z);
-            console.log(`JSEngine: Moved prop ${index} to (${x.toFixed(2)}, ${y.toFixed(2)}, ${z.toFixed(2)})`);
-            return true;
+        this.propCommands.move(index, x, y, z);
+        return true;
+    }
+
+    /**
+     * Read the player position from the numeric game.playerPosition{X,Y,Z} properties
+     * @param {{x: number, y: number, z: number}} [out] - Optional object to fill; reused between calls when omitted
+     * @returns {{x: number, y: number, z: number}}
+     */
+    getPlayerPosition(out = this.playerPositionScratch) {
+        if (typeof game !== 'undefined' && game.playerPositionX !== undefined) {
+            out.x = game.playerPositionX;
+            out.y = game.playerPositionY;
+            out.z = game.playerPositionZ;
+            return out;
         }
-        console.warn('JSEngine: moveProp not available');
-        return false;
+        console.warn('JSEngine: game.playerPosition not available');
+        out.x = 0;
+        out.y = 0;
+        out.z = 0;
+        return out;
     }
 
-    getPlayerPosition() {
-        if (typeof game !== 'undefined' && game.getPlayerPos) {
-            return game.getPlayerPos();
+    /**
+     * Prop indices whose bounds overlap a sphere, answered by the C++ spatial grid instead of a scan over every prop.
+     * Reflects prop positions as of the end of the last game.update().
+     * @param {number} x
+     * @param {number} y
+     * @param {number} z
+     * @param {number} radius
+     * @param {number[]} [out] - Optional array to fill; reused between calls when omitted
+     * @returns {number[]}
+     */
+    queryPropsInRadius(x, y, z, radius, out = this.propQueryScratch) {
+        out.length = 0;
+        if (typeof game === 'undefined' || !game.queryPropsInRadius) {
+            console.warn('JSEngine: queryPropsInRadius not available');
+            return out;
+        }
+
+        const count = game.queryPropsInRadius(x, y, z, radius);
+        for (let i = 0; i < count; i++) {
+            out.push(game.getQueriedProp(i));
         }
-        console.warn('JSEngine: getPlayerPos not available');
-        return {x: 0, y: 0, z: 0};
+        return out;
     }
 
     moveCamera(x, y, z) {
@@ -317,6 +455,7 @@ export class JSEngine {
             isInitialized: this.isInitialized,
             hasGame: this.game !== null,
             frameCount: this.frameCount,
+            lastUpdateMs: this.scheduler.lastFrameMs,
             systemCount: this.registeredSystems.size,
             updateSystemCount: this.updateSystems.length,
             renderSystemCount: this.renderSystems.length,
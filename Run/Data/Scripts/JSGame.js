@@ -9,6 +9,7 @@ import {AudioSystem} from './components/AudioSystem.js';
 import {CubeSpawner} from './components/CubeSpawner.js';
 import {PropMover} from './components/PropMover.js';
 import {CameraShaker} from './components/CameraShaker.js';
+import {BenchmarkRunner} from './components/BenchmarkRunner.js';
 // import {NewFeatureSystem} from './components/NewFeatureSystem.js';
 
 /**
@@ -65,6 +66,14 @@ export class JSGame
         this.cameraShaker = new CameraShaker(this.engine);
 
         // this.newFeature = new NewFeatureSystem();
+
+        // Headless benchmark (App started with -benchmark); the demo spawner and camera shake would skew it
+        this.isBenchmarkMode = typeof game !== 'undefined' && game.benchmarkMode === true;
+        if (this.isBenchmarkMode) {
+            this.benchmarkRunner = new BenchmarkRunner(this.engine);
+            this.cubeSpawner.enabled = false;
+            this.cameraShaker.enabled = false;
+        }
         console.log('JSGame: All component instances created (Phase 4 ES6)');
     }
 
@@ -91,6 +100,11 @@ export class JSGame
         this.engine.registerSystem(null, this.cameraShaker);    // Priority: 40
 
         // this.engine.registerSystem(null, this.newFeature);
+
+        if (this.isBenchmarkMode) {
+            this.engine.registerSystem(null, this.benchmarkRunner);   // Priority: 95
+            game.gameState = 'GAME';
+        }
         console.log('(JSGame::registerGameSystems)(end) - All systems registered with SystemComponent pattern');
     }
 
@@ -15,7 +15,7 @@ import { SystemComponent } from '../core/SystemComponent.js';
  */
 export class AudioSystem extends SystemComponent {
     constructor() {
-        super('audioSystem', 5, { enabled: true });
+        super('audioSystem', 5, { enabled: true, budgetMs: 1 });
 
         this.loadedSounds = new Map(); // Cache for loaded sound IDs
         this.activeSounds = new Map(); // Track active playback IDs
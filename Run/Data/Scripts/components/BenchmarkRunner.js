@@ -0,0 +1,280 @@
+//----------------------------------------------------------------------------------------------------
+// BenchmarkRunner.js - Headless benchmark scenarios (registered only with -benchmark)
+//----------------------------------------------------------------------------------------------------
+
+import {nowMilliseconds} from '../core/SystemScheduler.js';
+
+/**
+ * Nearest-rank percentile of an ascending array
+ */
+export function percentile(sortedValues, fraction) {
+    if (sortedValues.length === 0) {
+        return 0;
+    }
+    const rank = Math.ceil(fraction * sortedValues.length) - 1;
+    return sortedValues[Math.min(Math.max(rank, 0), sortedValues.length - 1)];
+}
+
+/**
+ * min / mean / p50 / p95 / p99 / max of a list of frame times
+ */
+export function summarizeFrameTimes(frameTimesMs) {
+    const sorted = Float64Array.from(frameTimesMs).sort();
+    let total = 0;
+    for (const value of sorted) {
+        total += value;
+    }
+    return {
+        count: sorted.length,
+        minMs: sorted.length ? sorted[0] : 0,
+        meanMs: sorted.length ? total / sorted.length : 0,
+        p50Ms: percentile(sorted, 0.50),
+        p95Ms: percentile(sorted, 0.95),
+        p99Ms: percentile(sorted, 0.99),
+        maxMs: sorted.length ? sorted[sorted.length - 1] : 0
+    };
+}
+
+/**
+ * mean / max of a list of per-frame counts; null when nothing was sampled
+ */
+export function summarizeCounts(values) {
+    if (values.length === 0) {
+        return null;
+    }
+    let total = 0;
+    let max = 0;
+    for (const value of values) {
+        total += value;
+        max = Math.max(max, value);
+    }
+    return {mean: total / values.length, max};
+}
+
+/**
+ * Optional native counter; null when this build does not expose it
+ */
+function readNativeNumber(name) {
+    return typeof game !== 'undefined' && typeof game[name] === 'number' ? game[name] : null;
+}
+
+/**
+ * Arms or disarms the native allocation budget; a no-op in builds without the binding
+ */
+function setAllocationBudgetArmed(isArmed) {
+    if (typeof game !== 'undefined' && typeof game.setAllocationBudgetArmed === 'function') {
+        game.setAllocationBudgetArmed(isArmed);
+    }
+}
+
+/**
+ * Cubes on a flat grid in front of the start position, so every scenario draws the same scene
+ */
+function spawnCubeGrid(runner, count) {
+    const side = Math.ceil(Math.sqrt(count));
+    for (let i = 0; i < count; i++) {
+        const handle = game.createCube(2 + (i % side) * 0.5, -side * 0.25 + Math.floor(i / side) * 0.5, 0);
+        if (handle >= 0) {
+            runner.handles.push(handle);
+        }
+    }
+}
+
+/**
+ * The scenario list. setup() runs once, perFrame() every frame of warmup and measurement; props a scenario
+ * spawns go in runner.handles and are destroyed before the next one starts (a frame later, see finishScenario).
+ */
+export const BENCHMARK_SCENARIOS = [
+    {name: 'baseline', frames: 300},
+    {name: 'cubes_1k', frames: 300, setup: runner => spawnCubeGrid(runner, 1000)},
+    {name: 'cubes_10k', frames: 300, setup: runner => spawnCubeGrid(runner, 10000)},
+    {name: 'cubes_100k', frames: 300, setup: runner => spawnCubeGrid(runner, 100000)},
+    {
+        // One native crossing per prop per frame, the pattern the command buffer replaces
+        name: 'moveProp_10k_direct',
+        frames: 300,
+        setup: runner => spawnCubeGrid(runner, 10000),
+        perFrame: (runner, frame) => {
+            const z = Math.sin(frame * 0.1);
+            for (const handle of runner.handles) {
+                game.moveProp(handle, 2, 0, z);
+            }
+        }
+    },
+    {
+        // Same moves through JSEngine.propCommands, flushed in one crossing
+        name: 'moveProp_10k_batched',
+        frames: 300,
+        setup: runner => spawnCubeGrid(runner, 10000),
+        perFrame: (runner, frame) => {
+            const z = Math.sin(frame * 0.1);
+            const commands = runner.engine.propCommands;
+            for (const handle of runner.handles) {
+                commands.move(handle, 2, 0, z);
+            }
+        }
+    },
+    {
+        // Bumps a component's timestamp; the frames after it include the reload if the watcher sees it
+        name: 'hot_reload',
+        frames: 180,
+        warmupFrames: 0,
+        setup: () => game.touchScriptFile('Data/Scripts/components/PropMover.js')
+    }
+];
+
+/**
+ * BenchmarkRunner - Runs BENCHMARK_SCENARIOS one after another, then writes the report and quits
+ *
+ * Frame time is measured between consecutive updates, so it covers the whole frame (C++ update, render and
+ * present), not just script. The report (see game.writeBenchmarkReport) holds per-scenario frame time
+ * percentiles, setup time and process memory, plus the build's DevTools setting so runs can be compared.
+ * Heap allocations per measured frame come from game.frameAllocationCount / frameAllocatedBytes; the native
+ * allocation budget (-allocationBudget=N) is armed for measured frames only, since setup and warmup allocate
+ * by design. jsHeapUsedBytes is read from the game property of that name. Counters a build does not provide
+ * are reported as null.
+ *
+ * Priority: 95 (after every game system, so the frame a scenario starts on is fully measured)
+ */
+export class BenchmarkRunner {
+    constructor(engine, scenarios = BENCHMARK_SCENARIOS) {
+        // SystemComponent pattern (id, priority, config)
+        this.id = 'benchmarkRunner';
+        this.priority = 95;
+        this.enabled = true;
+        this.data = {
+            description: 'Runs the headless benchmark scenarios',
+            warmupFrames: 30
+        };
+
+        this.engine = engine;
+        this.scenarios = scenarios;
+        this.scenarioIndex = -1;
+        this.scenario = null;
+        this.frame = 0;
+        this.frameTimesMs = [];
+        this.allocationCounts = [];
+        this.allocatedBytes = [];
+        this.handles = [];
+        this.lastUpdateMs = 0;
+        this.results = [];
+        this.isFinished = false;
+
+        console.log(`BenchmarkRunner: Created (${scenarios.length} scenarios)`);
+    }
+
+    update(gameDelta, systemDelta) {
+        if (this.isFinished) {
+            return;
+        }
+
+        const nowMs = nowMilliseconds();
+        const frameMs = this.lastUpdateMs > 0 ? nowMs - this.lastUpdateMs : 0;
+        this.lastUpdateMs = nowMs;
+
+        if (this.scenario === null) {
+            this.startNextScenario();
+            return;
+        }
+
+        const warmupFrames = this.scenario.warmupFrames ?? this.data.warmupFrames;
+        if (this.frame > warmupFrames) {
+            this.frameTimesMs.push(frameMs);
+            this.sampleAllocations();
+        } else if (this.frame === warmupFrames) {
+            setAllocationBudgetArmed(true);
+        }
+
+        if (this.frame >= warmupFrames + this.scenario.frames) {
+            // The next scenario starts on the next update, after C++ has applied the destroys queued here
+            this.finishScenario();
+            return;
+        }
+
+        if (this.scenario.perFrame) {
+            this.scenario.perFrame(this, this.frame);
+        }
+        this.frame++;
+    }
+
+    startNextScenario() {
+        this.scenarioIndex++;
+        setAllocationBudgetArmed(false);
+        if (this.scenarioIndex >= this.scenarios.length) {
+            this.writeReport();
+            return;
+        }
+
+        this.scenario = this.scenarios[this.scenarioIndex];
+        this.frame = 0;
+        this.frameTimesMs = [];
+        this.allocationCounts = [];
+        this.allocatedBytes = [];
+        this.memoryAtStart = readNativeNumber('processPrivateBytes');
+        this.overBudgetFramesAtStart = readNativeNumber('allocationOverBudgetFrames');
+
+        const setupStartMs = nowMilliseconds();
+        if (this.scenario.setup) {
+            this.scenario.setup(this);
+        }
+        this.setupMs = nowMilliseconds() - setupStartMs;
+
+        console.log(`BenchmarkRunner: Scenario '${this.scenario.name}' started (setup ${this.setupMs.toFixed(1)} ms)`);
+    }
+
+    sampleAllocations() {
+        const count = readNativeNumber('frameAllocationCount');
+        if (count !== null) {
+            this.allocationCounts.push(count);
+            this.allocatedBytes.push(readNativeNumber('frameAllocatedBytes'));
+        }
+    }
+
+    finishScenario() {
+        const result = {
+            name: this.scenario.name,
+            setupMs: this.setupMs,
+            propCount: readNativeNumber('livePropCount'),
+            frameTime: summarizeFrameTimes(this.frameTimesMs),
+            processPrivateBytesStart: this.memoryAtStart,
+            processPrivateBytesEnd: readNativeNumber('processPrivateBytes'),
+            jsHeapUsedBytes: readNativeNumber('jsHeapUsedBytes'),
+            allocationsPerFrame: summarizeCounts(this.allocationCounts),
+            allocatedBytesPerFrame: summarizeCounts(this.allocatedBytes),
+            allocationOverBudgetFrames: this.overBudgetFramesAtStart === null ? null :
+                readNativeNumber('allocationOverBudgetFrames') - this.overBudgetFramesAtStart
+        };
+        this.results.push(result);
+
+        console.log(`BenchmarkRunner: ${result.name}: p50 ${result.frameTime.p50Ms.toFixed(2)} ms, ` +
+                    `p95 ${result.frameTime.p95Ms.toFixed(2)} ms, p99 ${result.frameTime.p99Ms.toFixed(2)} ms`);
+
+        // Queued, not applied: JSEngine flushes them after this update and C++ applies them before the next one
+        for (const handle of this.handles) {
+            this.engine.destroyProp(handle);
+        }
+        this.handles = [];
+        this.scenario = null;
+    }
+
+    writeReport() {
+        this.isFinished = true;
+
+        const report = {
+            version: 1,
+            timestamp: new Date().toISOString(),
+            devToolsEnabled: typeof game !== 'undefined' ? game.devToolsEnabled : null,
+            scriptRuntimeProfile: typeof game !== 'undefined' ? game.scriptRuntimeProfile : null,
+            hotReloadEnabled: !!this.engine.hotReloadEnabled,
+            scriptStartupMs: readNativeNumber('scriptStartupMs'),
+            scenarios: this.results
+        };
+
+        if (typeof game !== 'undefined') {
+            game.writeBenchmarkReport(JSON.stringify(report, null, 2));
+            game.appRequestQuit();
+        }
+    }
+}
+
+console.log('BenchmarkRunner: Component loaded (ECS pattern)');
@@ -2,6 +2,8 @@
 // CameraShaker.js - Camera Shake Effect System Component
 //----------------------------------------------------------------------------------------------------
 
+import {random} from '../core/SeededRandom.js';
+
 /**
  * CameraShaker - Applies camera shake effects at regular intervals
  *
@@ -59,9 +61,9 @@ export class CameraShaker {
      */
     applyShake() {
         if (this.engine) {
-            const shakeX = (Math.random() - 0.5) * 0.2;  // Random X offset: -0.1 to 0.1
-            const shakeY = (Math.random() - 0.5) * 0.2;  // Random Y offset: -0.1 to 0.1
-            const shakeZ = (Math.random() - 0.5) * 0.1;  // Random Z offset: -0.05 to 0.05
+            const shakeX = (random() - 0.5) * 0.2;  // Random X offset: -0.1 to 0.1
+            const shakeY = (random() - 0.5) * 0.2;  // Random Y offset: -0.1 to 0.1
+            const shakeZ = (random() - 0.5) * 0.1;  // Random Z offset: -0.05 to 0.05
 
             this.engine.moveCamera(shakeX, shakeY, shakeZ);
             console.log(`CameraShaker: Applied shake (${shakeX.toFixed(3)}, ${shakeY.toFixed(3)}, ${shakeZ.toFixed(3)})`);
@@ -85,6 +87,11 @@ export class CameraShaker {
         return this.data.interval;
     }
 
+    // Hot reload (see SystemComponent): keep the shake timer
+    migrate(previous) {
+        this.data.lastShakeFrame = previous.data.lastShakeFrame;
+    }
+
     /**
      * Static version for hot-reload detection
      * AI agents can trigger hot-reload by modifying this file
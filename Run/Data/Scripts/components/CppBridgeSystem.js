@@ -40,7 +40,8 @@ export class CppBridgeSystem {
      * @param {number} systemDelta - System time delta (never pauses)
      */
     update(gameDelta, systemDelta) {
-        this.frameCount++;
+        // Counts simulation steps, matching JSEngine.frameCount under a fixed timestep
+        this.frameCount += this.engine?.frameStepCount ?? 1;
 
         // Call C++ engine update if available
         if (this.engine) {
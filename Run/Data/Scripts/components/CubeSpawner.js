@@ -2,6 +2,8 @@
 // CubeSpawner.js - Cube Spawning System Component
 //----------------------------------------------------------------------------------------------------
 
+import {random} from '../core/SeededRandom.js';
+
 /**
  * CubeSpawner - Spawns cubes at regular intervals
  *
@@ -9,6 +11,7 @@
  * - Spawn cubes every 4 seconds (240 frames at 60fps)
  * - Generate random positions within game space
  * - Track last spawn frame for timing
+ * - Keep at most maxCubes alive, destroying the oldest so long sessions run at flat memory
  *
  * Priority: 20 (Medium - after input, before prop movement)
  *
@@ -22,12 +25,17 @@ export class CubeSpawner {
         this.id = 'cubeSpawner';
         this.priority = 20;
         this.enabled = true;
+        this.budgetMs = 1; // Spawning can slip a frame, so a slow spawn defers instead of stretching the frame
         this.data = {
             description: 'Spawns cubes every 4 seconds',
             lastSpawnFrame: 0,
-            interval: 240 // 4 seconds at 60fps
+            interval: 240, // 4 seconds at 60fps
+            maxCubes: 64
         };
 
+        // Handles of the cubes this spawner owns, oldest first
+        this.spawnedHandles = [];
+
         // Dependencies
         this.engine = engine;
 
@@ -57,12 +65,19 @@ export class CubeSpawner {
      */
     spawnCube() {
         if (this.engine) {
-            const x = (Math.random() - 0.5) * 10;  // Random x: -5 to 5
-            const y = (Math.random() - 0.5) * 10;  // Random y: -5 to 5
-            const z = Math.random() * 3;            // Random z: 0 to 3
+            const x = (random() - 0.5) * 10;  // Random x: -5 to 5
+            const y = (random() - 0.5) * 10;  // Random y: -5 to 5
+            const z = random() * 3;            // Random z: 0 to 3
 
-            this.engine.createCube(x, y, z);
+            const handle = this.engine.createCube(x, y, z);
+            if (handle >= 0) {
+                this.spawnedHandles.push(handle);
+            }
             console.log(`CubeSpawner: Spawned cube at (${x.toFixed(2)}, ${y.toFixed(2)}, ${z.toFixed(2)})`);
+
+            while (this.spawnedHandles.length > this.data.maxCubes) {
+                this.engine.destroyProp(this.spawnedHandles.shift());
+            }
         }
     }
 
@@ -83,6 +98,12 @@ export class CubeSpawner {
         return this.data.interval;
     }
 
+    // Hot reload (see SystemComponent): keep the spawn timer and the cubes spawned so far
+    migrate(previous) {
+        this.data.lastSpawnFrame = previous.data.lastSpawnFrame;
+        this.spawnedHandles = previous.spawnedHandles ?? [];     // Else the old cubes would never be destroyed
+    }
+
     /**
      * Static version for hot-reload detection
      * AI agents can trigger hot-reload by modifying this file
@@ -2,6 +2,8 @@
 // PropMover.js - Prop Movement System Component
 //----------------------------------------------------------------------------------------------------
 
+import {random} from '../core/SeededRandom.js';
+
 /**
  * PropMover - Moves props at regular intervals
  *
@@ -58,9 +60,9 @@ export class PropMover {
     moveProp() {
         if (this.engine) {
             const propIndex = 0; // Move the first prop
-            const x = (Math.random() - 0.5) * 8;   // Random x: -4 to 4
-            const y = (Math.random() - 0.5) * 8;   // Random y: -4 to 4
-            const z = Math.random() * 2;            // Random z: 0 to 2
+            const x = (random() - 0.5) * 8;   // Random x: -4 to 4
+            const y = (random() - 0.5) * 8;   // Random y: -4 to 4
+            const z = random() * 2;            // Random z: 0 to 2
 
             this.engine.moveProp(propIndex, x, y, z);
             console.log(`PropMover: Moved prop ${propIndex} to (${x.toFixed(2)}, ${y.toFixed(2)}, ${z.toFixed(2)})`);
@@ -84,6 +86,11 @@ export class PropMover {
         return this.data.interval;
     }
 
+    // Hot reload (see SystemComponent): keep the move timer
+    migrate(previous) {
+        this.data.lastMoveFrame = previous.data.lastMoveFrame;
+    }
+
     /**
      * Static version for hot-reload detection
      * AI agents can trigger hot-reload by modifying this file
@@ -0,0 +1,66 @@
+//----------------------------------------------------------------------------------------------------
+// Profiler.js - Script zones in the C++ frame profiler
+//----------------------------------------------------------------------------------------------------
+
+// Looked up once: builds with GAME_DISABLE_PROFILER register no profile* methods, and then every call below
+// returns without crossing into C++
+const hasNativeProfiler = typeof game !== 'undefined' && !!game.profileBegin;
+
+/**
+ * profiler - Times script work alongside the C++ PROFILE_SCOPE zones (see Code/Game/Framework/Profiler.hpp)
+ *
+ * Zones show up in the F3 overlay and in F4 / startCapture() trace captures under their name. begin() and
+ * end() must pair up within a frame; nesting is fine. Names are interned by C++, so use a fixed set of names
+ * rather than building a new string per call.
+ *
+ *   profiler.begin('CubeSpawner');
+ *   ...
+ *   profiler.end();
+ *
+ *   profiler.scope('Physics', () => step());
+ */
+export const profiler = {
+    isAvailable: hasNativeProfiler,
+    enabled: true,
+
+    begin(name) {
+        if (hasNativeProfiler && this.enabled) {
+            game.profileBegin(name);
+        }
+    },
+
+    end() {
+        if (hasNativeProfiler && this.enabled) {
+            game.profileEnd();
+        }
+    },
+
+    /**
+     * Run fn inside a zone; the zone is closed even if fn throws
+     * @returns whatever fn returns
+     */
+    scope(name, fn) {
+        this.begin(name);
+        try {
+            return fn();
+        } finally {
+            this.end();
+        }
+    },
+
+    startCapture() {
+        if (hasNativeProfiler) {
+            game.profileStartCapture();
+        }
+    },
+
+    /**
+     * Write everything since startCapture() as Chrome trace JSON (chrome://tracing, ui.perfetto.dev)
+     * @returns {number} Zones written, or -1 if nothing was capturing or the file could not be written
+     */
+    stopCapture(path = 'Logs/ProfilerTrace.json') {
+        return hasNativeProfiler ? game.profileStopCapture(path) : -1;
+    }
+};
+
+console.log(`Profiler: Module loaded (Phase 4 ES6)${hasNativeProfiler ? '' : ' - native profiler not available'}`);
@@ -0,0 +1,133 @@
+//----------------------------------------------------------------------------------------------------
+// PropCommandBuffer.js - Packed prop command buffer for game.submitCommands()
+//----------------------------------------------------------------------------------------------------
+
+/**
+ * PROP_COMMAND - Opcodes understood by game.submitCommands()
+ * Must stay in sync with ePropCommand in Code/Game/Gameplay/PropCommand.hpp
+ */
+export const PROP_COMMAND = Object.freeze({
+    MOVE: 0,                  // propIndex, x, y, z
+    SET_COLOR: 1,             // propIndex, r, g, b, a (0-255)
+    SET_ANGULAR_VELOCITY: 2,  // propIndex, yaw, pitch, roll (degrees per second)
+    SPAWN: 3,                 // x, y, z, r, g, b, a
+    DESTROY: 4                // propIndex
+});
+
+/**
+ * PROP_HANDLE - Prop handle layout, must match PropHandle in Code/Game/Gameplay/PropPool.hpp
+ * The low SLOT_BITS are the prop's slot in the pool; the bits above are the slot's generation,
+ * so a handle kept after its prop was destroyed is rejected by C++ once the slot is reused.
+ */
+export const PROP_HANDLE = Object.freeze({
+    INVALID: -1,
+    SLOT_BITS: 17,
+    SLOT_MASK: (1 << 17) - 1
+});
+
+/**
+ * PropCommandBuffer - Collects prop mutations for a frame and sends them to C++ in one call
+ *
+ * Systems queue commands during update(); JSEngine flushes the buffer once at the end of the frame.
+ * C++ applies the batch at the start of the next Game::Update, in submission order.
+ *
+ * The backing Float32Array grows on demand and is reused, so queuing never allocates in steady state.
+ */
+export class PropCommandBuffer {
+    constructor(initialCapacity = 1024) {
+        this.buffer = new Float32Array(initialCapacity);
+        this.length = 0;
+    }
+
+    move(propIndex, x, y, z) {
+        this.push5(PROP_COMMAND.MOVE, propIndex, x, y, z);
+    }
+
+    setColor(propIndex, r, g, b, a = 255) {
+        this.reserve(6);
+        const buffer = this.buffer;
+        let i = this.length;
+        buffer[i++] = PROP_COMMAND.SET_COLOR;
+        buffer[i++] = propIndex;
+        buffer[i++] = r;
+        buffer[i++] = g;
+        buffer[i++] = b;
+        buffer[i++] = a;
+        this.length = i;
+    }
+
+    setAngularVelocity(propIndex, yaw, pitch, roll) {
+        this.push5(PROP_COMMAND.SET_ANGULAR_VELOCITY, propIndex, yaw, pitch, roll);
+    }
+
+    spawn(x, y, z, r = 255, g = 255, b = 255, a = 255) {
+        this.reserve(8);
+        const buffer = this.buffer;
+        let i = this.length;
+        buffer[i++] = PROP_COMMAND.SPAWN;
+        buffer[i++] = x;
+        buffer[i++] = y;
+        buffer[i++] = z;
+        buffer[i++] = r;
+        buffer[i++] = g;
+        buffer[i++] = b;
+        buffer[i++] = a;
+        this.length = i;
+    }
+
+    destroy(propIndex) {
+        this.reserve(2);
+        this.buffer[this.length++] = PROP_COMMAND.DESTROY;
+        this.buffer[this.length++] = propIndex;
+    }
+
+    /**
+     * Send every queued command to C++ and reset the buffer
+     * Large batches are split into chunks so the spread call stays under the engine's argument limit;
+     * the chunks are concatenated again on the C++ side before decoding.
+     * @returns {boolean} True when the batch was handed to C++
+     */
+    flush() {
+        if (this.length === 0) {
+            return true;
+        }
+
+        if (typeof game === 'undefined' || !game.submitCommands) {
+            console.warn('PropCommandBuffer: game.submitCommands not available, dropping commands');
+            this.length = 0;
+            return false;
+        }
+
+        for (let start = 0; start < this.length; start += PropCommandBuffer.MAX_VALUES_PER_CALL) {
+            const end = Math.min(start + PropCommandBuffer.MAX_VALUES_PER_CALL, this.length);
+            game.submitCommands(...this.buffer.subarray(start, end));
+        }
+
+        this.length = 0;
+        return true;
+    }
+
+    push5(opcode, a, b, c, d) {
+        this.reserve(5);
+        const buffer = this.buffer;
+        let i = this.length;
+        buffer[i++] = opcode;
+        buffer[i++] = a;
+        buffer[i++] = b;
+        buffer[i++] = c;
+        buffer[i++] = d;
+        this.length = i;
+    }
+
+    reserve(count) {
+        if (this.length + count <= this.buffer.length) {
+            return;
+        }
+
+        const grown = new Float32Array(Math.max(this.buffer.length * 2, this.length + count));
+        grown.set(this.buffer.subarray(0, this.length));
+        this.buffer = grown;
+    }
+}
+
+PropCommandBuffer.MAX_VALUES_PER_CALL = 8192;
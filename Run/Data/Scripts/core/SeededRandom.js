@@ -0,0 +1,44 @@
+//----------------------------------------------------------------------------------------------------
+// SeededRandom.js - Seeded replacement for Math.random()
+//----------------------------------------------------------------------------------------------------
+
+/**
+ * SeededRandom - Mulberry32, the same generator as Code/Game/Framework/SeededRandom.hpp
+ *
+ * Math.random() cannot be seeded, so a recorded session (-record / -replay, see
+ * Code/Game/Framework/ReplaySession.hpp) could never spawn or move anything the same way twice.
+ * Components call random() below instead; it draws from one stream seeded by game.randomSeed.
+ */
+export class SeededRandom {
+    constructor(seed) {
+        this.state = seed | 0;
+    }
+
+    /**
+     * @returns {number} In [0, 1), like Math.random()
+     */
+    next() {
+        this.state = (this.state + 0x6D2B79F5) | 0;
+
+        let value = this.state;
+        value = Math.imul(value ^ (value >>> 15), value | 1);
+        value ^= value + Math.imul(value ^ (value >>> 7), value | 61);
+        return ((value ^ (value >>> 14)) >>> 0) / 4294967296;
+    }
+}
+
+// Created on first use, once the game binding exists; kept by module state across component hot reloads
+let sharedRandom = null;
+
+/**
+ * Drop-in for Math.random() from the session's stream
+ */
+export function random() {
+    if (sharedRandom === null) {
+        const seed = (typeof game !== 'undefined' && typeof game.randomSeed === 'number') ? game.randomSeed : Date.now();
+        sharedRandom = new SeededRandom(seed);
+    }
+    return sharedRandom.next();
+}
+
+console.log('SeededRandom: Module loaded (Phase 4 ES6)');
@@ -9,6 +9,10 @@
  * All systems must extend this class and implement:
  * - update(gameDelta, systemDelta) method
  * - render() method (optional)
+ * - migrate(previous) method (optional) - hot-reload hook, called right after construction when this instance
+ *   replaces a registered one with the same id, so runtime state (timers, owned prop handles) survives the
+ *   reload (see JSEngine.registerSystem). Copy runtime state only: configuration such as an interval comes from
+ *   the new code. Without it the system starts over. Not defined here, so JSEngine can tell who implements it.
  *
  * Design Philosophy:
  * - Each system = separate file (AI agent can edit independently)
@@ -42,16 +46,22 @@ export class SystemComponent {
         this.enabled = config.enabled !== false; // Default: true
         this.data = config.data || {}; // System-specific data storage
 
+        // Scheduling hints read by JSEngine's SystemScheduler (see core/SystemScheduler.js)
+        this.tickEveryFrames = config.tickEveryFrames || 1; // Run every Nth update
+        this.tickHz = config.tickHz || 0;                   // Or at most this often per second (0 = off)
+        this.budgetMs = config.budgetMs || 0;               // Expected cost; > 0 lets the scheduler defer it
+
         // Logging
         console.log(`SystemComponent: '${this.id}' created (priority: ${this.priority})`);
     }
 
     /**
-     * Update method - called every frame with delta time
+     * Update method - called when due with the time since the last run
      * @param {number} gameDelta - Game time delta (pauses when game paused)
      * @param {number} systemDelta - System time delta (never pauses)
+     * @param {{hasTime: function(): boolean}} [slice] - False once this system's budgetMs is spent
      */
-    update(gameDelta, systemDelta) {
+    update(gameDelta, systemDelta, slice) {
         // Override in subclass
         // Example:
         // update(gameDelta, systemDelta) {
@@ -0,0 +1,226 @@
+//----------------------------------------------------------------------------------------------------
+// SystemScheduler.js - Tick rates, time budgets and cost tracking for JSEngine update systems
+//----------------------------------------------------------------------------------------------------
+
+/**
+ * Milliseconds from the C++ high-resolution clock (game.nowMilliseconds), falling back to Date.now()
+ * outside the engine. Date.now() only has millisecond resolution, so costs it reports are coarse.
+ */
+export function nowMilliseconds() {
+    if (typeof game !== 'undefined' && game.nowMilliseconds) {
+        return game.nowMilliseconds();
+    }
+    return Date.now();
+}
+
+/**
+ * Insert a system after every system of lower or equal priority (binary search, so registration order is kept
+ * among equal priorities and the list is never re-sorted)
+ */
+export function insertByPriority(systems, system) {
+    let low = 0;
+    let high = systems.length;
+    while (low < high) {
+        const mid = (low + high) >>> 1;
+        if (systems[mid].priority <= system.priority) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    systems.splice(low, 0, system);
+}
+
+/**
+ * Remove the system with this id, if present, without rebuilding the list
+ */
+export function removeById(systems, id) {
+    const index = systems.findIndex(sys => sys.id === id);
+    if (index >= 0) {
+        systems.splice(index, 1);
+    }
+}
+
+/**
+ * SystemScheduler - Decides which update systems run each frame and measures what they cost
+ *
+ * A system may declare, on its component or legacy config:
+ * - tickEveryFrames: run on every Nth update (default 1)
+ * - tickHz: run at most this many times per second of system time; takes precedence over tickEveryFrames.
+ *   Each run consumes exactly one 1/tickHz period and keeps the rest, so the rate holds at frame rates that
+ *   do not divide it. The carried time is kept below one period: time lost to a hitch is dropped instead
+ *   of being caught up with back-to-back runs.
+ * - budgetMs: expected cost per run. A system with a budget may be deferred: when the frame has already
+ *   spent frameBudgetMs, or running it would cross that line at its average cost, it waits for a later
+ *   frame. It is never deferred more than maxDeferredFrames in a row, so it cannot starve.
+ *
+ * Systems without a budget (CppBridgeSystem, InputSystem) always run when due. A system that skips or
+ * defers frames receives the game/system deltas accumulated since it last ran, so time still adds up.
+ *
+ * isDeterministic turns deferral off and gives every slice unlimited time, so which systems run depends only
+ * on the frame and its deltas, never on how long the last frame took. JSEngine sets it while a session is
+ * recorded or replayed (game.replayMode). Costs are still measured.
+ *
+ * update() receives a third argument, a slice with hasTime(), true until the system's own budget is spent.
+ * Systems with incremental work can stop when it turns false and carry on next run; others ignore it.
+ *
+ * The system list is kept in priority order by insertByPriority, so registration never re-sorts it.
+ */
+export class SystemScheduler {
+    constructor(clock = nowMilliseconds) {
+        this.clock = clock;
+        this.frameBudgetMs = 8;
+        this.maxDeferredFrames = 4;
+        this.costSmoothing = 0.1;     // Weight of the newest sample in averageMs
+        this.isDeterministic = false;
+        this.systems = [];
+        this.lastFrameMs = 0;
+    }
+
+    /**
+     * Add a system, replacing any earlier one with the same id (hot-reload re-registers under the same id)
+     */
+    add(system) {
+        removeById(this.systems, system.id);
+
+        if (!system.schedule) {
+            system.schedule = this.createSchedule(system);
+        }
+
+        insertByPriority(this.systems, system);
+    }
+
+    remove(id) {
+        removeById(this.systems, id);
+    }
+
+    /**
+     * Run every enabled, due system once
+     * @param {function(Object, number, number, Object)} invoke - Calls the system; owns error handling
+     */
+    run(gameDeltaSeconds, systemDeltaSeconds, invoke) {
+        const clock = this.clock;
+        const frameStartMs = clock();
+
+        for (const system of this.systems) {
+            if (!system.enabled || !system.update) {
+                continue;
+            }
+
+            const schedule = system.schedule;
+            schedule.pendingGameSeconds += gameDeltaSeconds;
+            schedule.pendingSystemSeconds += systemDeltaSeconds;
+            schedule.tickPhaseSeconds += systemDeltaSeconds;
+            schedule.updatesSinceRun++;
+
+            if (!this.isDue(schedule)) {
+                continue;
+            }
+
+            const startMs = clock();
+
+            const hasBudget = schedule.budgetMs > 0 && !this.isDeterministic;
+
+            if (hasBudget && schedule.deferredFrames < this.maxDeferredFrames &&
+                startMs - frameStartMs + schedule.averageMs > this.frameBudgetMs) {
+                schedule.deferredFrames++;
+                schedule.deferrals++;
+                continue;
+            }
+
+            schedule.slice.deadlineMs = hasBudget ? startMs + schedule.budgetMs : Infinity;
+            invoke(system, schedule.pendingGameSeconds, schedule.pendingSystemSeconds, schedule.slice);
+
+            const costMs = clock() - startMs;
+            schedule.lastMs = costMs;
+            schedule.averageMs = schedule.runs === 0 ? costMs : schedule.averageMs + (costMs - schedule.averageMs) * this.costSmoothing;
+            schedule.peakMs = Math.max(schedule.peakMs, costMs);
+            schedule.runs++;
+            if (schedule.budgetMs > 0 && costMs > schedule.budgetMs) {
+                schedule.overBudgetRuns++;
+            }
+
+            schedule.pendingGameSeconds = 0;
+            schedule.pendingSystemSeconds = 0;
+            schedule.updatesSinceRun = 0;
+            schedule.deferredFrames = 0;
+            if (schedule.tickHz > 0) {
+                schedule.tickPhaseSeconds %= 1 / schedule.tickHz;
+            }
+        }
+
+        this.lastFrameMs = clock() - frameStartMs;
+    }
+
+    isDue(schedule) {
+        if (schedule.tickHz > 0) {
+            return schedule.tickPhaseSeconds >= 1 / schedule.tickHz;
+        }
+        return schedule.updatesSinceRun >= schedule.tickEveryFrames;
+    }
+
+    /**
+     * Per-system cost, most expensive (by average) first
+     * @returns {Array<{id: string, averageMs: number, peakMs: number, lastMs: number, budgetMs: number, runs: number, deferrals: number, overBudgetRuns: number}>}
+     */
+    getCostBreakdown() {
+        return this.systems
+            .map(sys => ({
+                id: sys.id,
+                averageMs: sys.schedule.averageMs,
+                peakMs: sys.schedule.peakMs,
+                lastMs: sys.schedule.lastMs,
+                budgetMs: sys.schedule.budgetMs,
+                runs: sys.schedule.runs,
+                deferrals: sys.schedule.deferrals,
+                overBudgetRuns: sys.schedule.overBudgetRuns
+            }))
+            .sort((a, b) => b.averageMs - a.averageMs);
+    }
+
+    /**
+     * One line per system, for console / DevConsole output
+     */
+    formatCostBreakdown() {
+        const lines = [`SystemScheduler: last frame ${this.lastFrameMs.toFixed(3)} ms (budget ${this.frameBudgetMs} ms)`];
+        for (const cost of this.getCostBreakdown()) {
+            const budget = cost.budgetMs > 0 ? `${cost.budgetMs} ms` : 'none';
+            lines.push(`  ${cost.id}: avg ${cost.averageMs.toFixed(3)} ms, peak ${cost.peakMs.toFixed(3)} ms, budget ${budget}, ` +
+                       `runs ${cost.runs}, deferred ${cost.deferrals}, over budget ${cost.overBudgetRuns}`);
+        }
+        return lines.join('\n');
+    }
+
+    createSchedule(source) {
+        const schedule = {
+            tickEveryFrames: Math.max(1, Math.floor(source.tickEveryFrames || 1)),
+            tickHz: source.tickHz || 0,
+            budgetMs: source.budgetMs || 0,
+            pendingGameSeconds: 0,
+            pendingSystemSeconds: 0,
+            tickPhaseSeconds: 0,        // tickHz: system time toward the next run, unlike the deltas not reset by a run
+            updatesSinceRun: 0,
+            deferredFrames: 0,
+            lastMs: 0,
+            averageMs: 0,
+            peakMs: 0,
+            runs: 0,
+            deferrals: 0,
+            overBudgetRuns: 0,
+            slice: null
+        };
+
+        // Allocated once per system; run() only moves the deadline
+        const clock = this.clock;
+        schedule.slice = {
+            deadlineMs: Infinity,
+            hasTime() {
+                return clock() < this.deadlineMs;
+            }
+        };
+
+        return schedule;
+    }
+}
+
+console.log('SystemScheduler: Module loaded (Phase 4 ES6)');
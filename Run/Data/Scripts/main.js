@@ -29,6 +29,11 @@ console.log('(main.js)(start) - Phase 4 ES6 Module Entry Point');
 // Create JSEngine instance
 const jsEngineInstance = new JSEngine();
 
+// A hot reload of this module finds the previous engine still in globalThis; systems migrate their state from it
+if (globalThis.JSEngine && globalThis.JSEngine.registeredSystems) {
+    jsEngineInstance.adoptPreviousEngine(globalThis.JSEngine);
+}
+
 // Create JSGame instance
 const jsGameInstance = new JSGame(jsEngineInstance);
 
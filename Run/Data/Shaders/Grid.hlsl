@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------------------------
+// Procedural world grid shader
+// Draws the grid lines analytically on a single flat quad instead of one box per line.
+// Outputs to the same two render targets as Bloom.hlsl so it can share the scene pass.
+//
+// Requires Vertex_PCU vertex data (Position, Color, UVs); the quad lies in the model XY plane.
+//------------------------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------------------------
+// Input to the Vertex shader stage.
+//------------------------------------------------------------------------------------------------
+struct VertexInput
+{
+	float3	a_position		: VERTEX_POSITION;
+	float4	a_color			: VERTEX_COLOR;
+	float2	a_uvTexCoords	: VERTEX_UVTEXCOORDS;
+	uint	a_vertexID		: SV_VertexID;
+};
+
+//------------------------------------------------------------------------------------------------
+// Output passed from the Vertex shader into the Pixel/fragment shader.
+//------------------------------------------------------------------------------------------------
+struct VertexOutPixelIn
+{
+	float4 v_position		: SV_Position;
+	float4 v_color			: SURFACE_COLOR;
+	float2 v_gridPosition	: SURFACE_GRIDPOSITION;
+};
+
+//------------------------------------------------------------------------------------------------
+struct PixelOutput
+{
+	float4 color : SV_Target0;
+	float4 emissive : SV_Target1;
+};
+
+//------------------------------------------------------------------------------------------------
+// CONSTANT BUFFERS
+//------------------------------------------------------------------------------------------------
+cbuffer CameraConstants : register(b3)
+{
+	float4x4	c_worldToCamera;
+	float4x4	c_cameraToRender;
+	float4x4	c_renderToClip;
+};
+
+cbuffer ModelConstants : register(b4)
+{
+	float4x4	c_modelToWorld;
+	float4		c_modelTint;
+};
+
+//------------------------------------------------------------------------------------------------
+// Grid layout, matching the box grid it replaces: one line per unit, every fifth line colored
+//------------------------------------------------------------------------------------------------
+static const float	GRID_HALF_EXTENT		= 50.0;
+static const float	GRID_LINE_HALF_WIDTH	= 0.025;
+static const float	GRID_AXIS_HALF_WIDTH	= 0.15;
+static const int	GRID_MAJOR_INTERVAL		= 5;
+
+static const float3	GRID_MINOR_COLOR		= float3(0.2, 0.2, 0.2);
+static const float3	GRID_MAJOR_X_COLOR		= float3(1.0, 0.0, 0.0);	// Lines running along X
+static const float3	GRID_MAJOR_Y_COLOR		= float3(0.0, 1.0, 0.0);	// Lines running along Y
+
+//------------------------------------------------------------------------------------------------
+// Coverage in [0,1] of the line nearest to `coordinate`; at least one pixel wide so distant lines don't shimmer
+//------------------------------------------------------------------------------------------------
+float GetLineCoverage( float coordinate, out int lineIndex )
+{
+	lineIndex = (int)round( coordinate );
+
+	float halfWidth = ( lineIndex == 0 ) ? GRID_AXIS_HALF_WIDTH : GRID_LINE_HALF_WIDTH;
+	float pixelSize = fwidth( coordinate );
+	float distance	= abs( coordinate - (float)lineIndex );
+
+	halfWidth = max( halfWidth, pixelSize * 0.5 );
+
+	// The box grid had no line on the far edge
+	if( lineIndex >= (int)GRID_HALF_EXTENT )
+	{
+		return 0.0;
+	}
+
+	return 1.0 - smoothstep( halfWidth - pixelSize, halfWidth + pixelSize, distance );
+}
+
+//------------------------------------------------------------------------------------------------
+float3 GetLineColor( int lineIndex, float3 majorColor )
+{
+	return ( lineIndex % GRID_MAJOR_INTERVAL == 0 ) ? majorColor : GRID_MINOR_COLOR;
+}
+
+//------------------------------------------------------------------------------------------------
+// VERTEX SHADER (VS)
+//------------------------------------------------------------------------------------------------
+VertexOutPixelIn VertexMain( VertexInput input )
+{
+	VertexOutPixelIn output;
+
+	float4 modelPos		= float4( input.a_position, 1.0 );
+	float4 worldPos		= mul( c_modelToWorld, modelPos );
+	float4 cameraPos	= mul( c_worldToCamera, worldPos );
+	float4 renderPos	= mul( c_cameraToRender, cameraPos );
+	float4 clipPos		= mul( c_renderToClip, renderPos );
+
+	output.v_position		= clipPos;
+	output.v_color			= input.a_color;
+	output.v_gridPosition	= input.a_position.xy;
+
+	return output;
+}
+
+//------------------------------------------------------------------------------------------------
+// PIXEL SHADER (PS)
+//------------------------------------------------------------------------------------------------
+PixelOutput PixelMain( VertexOutPixelIn input )
+{
+	int lineIndexX;		// Along-X lines are spaced in Y
+	int lineIndexY;
+	float coverageX = GetLineCoverage( input.v_gridPosition.y, lineIndexX );
+	float coverageY = GetLineCoverage( input.v_gridPosition.x, lineIndexY );
+
+	float coverage = max( coverageX, coverageY );
+	if( coverage <= 0.5 )
+	{
+		discard;
+	}
+
+	float3 lineColor = ( coverageX >= coverageY ) ? GetLineColor( lineIndexX, GRID_MAJOR_X_COLOR )
+												  : GetLineColor( lineIndexY, GRID_MAJOR_Y_COLOR );
+
+	float4 finalColor = float4( lineColor, 1.0 ) * input.v_color * c_modelTint;
+
+	PixelOutput output;
+	output.color	= finalColor;
+	output.emissive	= float4( finalColor.rgb * input.v_color.a, 1.0 );	// Same rule as Bloom.hlsl (vertex alpha drives glow)
+
+	return output;
+}